@@ -0,0 +1,24 @@
+#pragma once
+#include "IAcquisition.h"
+#include "../IADC.h"
+
+// Presents the newest acquired sample through IADC, so code written for
+// synchronous reads (WindVane::getDirection, calibration) takes samples
+// from the background engine instead of calling the driver. It drains the
+// ring on each read, so it must be the engine's only consumer.
+class AcquisitionADC : public IADC {
+public:
+    explicit AcquisitionADC(IAcquisition& source) : _source(source) {}
+
+    float read() const override { return readCode() / 4095.0f; }
+    uint16_t readCode() const override {
+        AcquiredSample block[32];
+        size_t n;
+        while ((n = _source.readBlock(block, 32)) != 0) _last = block[n - 1].code;
+        return _last;
+    }
+
+private:
+    IAcquisition& _source;
+    mutable uint16_t _last{0};
+};
@@ -0,0 +1,65 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <stdint.h>
+
+enum class FilterType : uint8_t {
+    None,          ///< Pass single samples straight through
+    MovingAverage, ///< Boxcar over `window` samples, one output per `decimation`
+    CIC            ///< Cascaded integrator-comb of `order` stages
+};
+
+struct FilterConfig {
+    FilterType type{FilterType::None};
+    uint16_t decimation{8}; ///< Raw samples consumed per output sample
+    uint16_t window{8};     ///< MovingAverage length; > decimation overlaps outputs
+    uint8_t order{3};       ///< CIC stages; more stages suppress more noise
+};
+
+// Oversampling/decimation over 12-bit ADC codes using integer accumulators
+// only. Outputs carry log2(gain) extra bits before normalisation, which is
+// where the added resolution comes from.
+class DecimationFilter {
+public:
+    static constexpr uint16_t kMaxWindow = 256;
+    static constexpr uint8_t kMaxOrder = 4;
+    // CIC registers are 32-bit and rely on modular wrap-around, which is
+    // exact while 12 + order * log2(decimation) fits
+    static constexpr unsigned kCicGrowthBits = 20;
+
+    explicit DecimationFilter(const FilterConfig& cfg = FilterConfig{});
+
+    // Feeds one raw code; returns true when a new output is available
+    bool push(uint16_t code);
+    // Filters count codes, writing one fraction in [0,1] per output produced.
+    // out must hold count / decimation() + 1 values; returns outputs written.
+    size_t process(const uint16_t* codes, size_t count, float* out);
+    void reset();
+
+    uint32_t output() const { return _output; }          ///< Scaled by gain()
+    uint32_t gain() const { return _gain; }
+    float outputFraction() const { return _output * _scale; }
+    uint16_t outputCode() const;
+    // True once startup transients have cleared
+    bool settled() const;
+
+    const FilterConfig& config() const { return _cfg; }
+    uint16_t decimation() const { return _cfg.decimation; }
+
+private:
+    FilterConfig _cfg;
+    uint32_t _gain{1};
+    float _scale{1.0f / 4095.0f};
+    uint32_t _output{0};
+    uint32_t _phase{0};   ///< Samples since the last output
+    uint32_t _pushed{0};  ///< Saturates once settled
+
+    // MovingAverage state
+    std::array<uint16_t, kMaxWindow> _window{};
+    uint32_t _sum{0};
+    size_t _head{0};
+
+    // CIC state: integrators run at the input rate, combs at the output rate
+    std::array<uint32_t, kMaxOrder> _integrators{};
+    std::array<uint32_t, kMaxOrder> _combDelay{};
+};
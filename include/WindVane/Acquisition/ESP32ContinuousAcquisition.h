@@ -0,0 +1,31 @@
+#pragma once
+#if defined(ARDUINO_ARCH_ESP32)
+#include "IAcquisition.h"
+
+// ESP32 acquisition using the ADC continuous (DMA) driver. The driver
+// averages conversionsPerSample raw conversions into each sample, and a
+// FreeRTOS task moves finished frames into the ring, so nothing runs on
+// the caller's thread. Only one instance can be active at a time.
+class ESP32ContinuousAcquisition final : public AcquisitionBase {
+public:
+    ESP32ContinuousAcquisition(int pin, uint32_t rateHz);
+    ~ESP32ContinuousAcquisition() override;
+
+    bool start() override;
+    void stop() override;
+    bool running() const override { return _task != nullptr; }
+
+private:
+    uint8_t _pin;
+    void* _task{nullptr}; ///< TaskHandle_t
+    void* _exited{nullptr}; ///< SemaphoreHandle_t, given when the task leaves its loop
+    volatile bool _stop{false};
+    uint32_t _startUs{0};
+
+    static void onFrame();
+    static void taskEntry(void* self);
+    void drainFrames();
+    void stopTask();
+    void release();
+};
+#endif
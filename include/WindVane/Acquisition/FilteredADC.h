@@ -0,0 +1,24 @@
+#pragma once
+#include "DecimationFilter.h"
+#include "../IADC.h"
+
+// IADC stage that oversamples another IADC. Each read pulls decimation()
+// raw samples through the filter and returns the decimated result, so
+// read() carries the filter's extra resolution and readCode() rounds it
+// back to 12 bits.
+class FilteredADC : public IADC {
+public:
+    FilteredADC(IADC& source, const FilterConfig& cfg)
+        : _source(source), _filter(cfg) {}
+
+    float read() const override;
+    uint16_t readCode() const override;
+
+    const DecimationFilter& filter() const { return _filter; }
+
+private:
+    IADC& _source;
+    mutable DecimationFilter _filter;
+
+    void pull() const;
+};
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstddef>
+#include <stdint.h>
+#include "SampleRing.h"
+
+struct AcquiredSample {
+    uint32_t timestampUs; ///< Microseconds since start(); wraps after ~71 min
+    uint16_t code;        ///< Raw 12-bit ADC code
+};
+
+// Background ADC sampling at a fixed rate. Samples queue in a ring until a
+// single consumer drains them with readBlock().
+class IAcquisition {
+public:
+    virtual ~IAcquisition() = default;
+    virtual bool start() = 0;
+    virtual void stop() = 0;
+    virtual bool running() const = 0;
+    // Moves up to maxCount of the oldest samples into out; returns how many
+    virtual size_t readBlock(AcquiredSample* out, size_t maxCount) = 0;
+    virtual size_t available() const = 0;
+    // Samples lost because the consumer fell a full ring behind
+    virtual size_t dropped() const = 0;
+    virtual uint32_t sampleRateHz() const = 0;
+};
+
+// Ring storage shared by the platform implementations.
+class AcquisitionBase : public IAcquisition {
+public:
+    static constexpr size_t kRingCapacity = 1024;
+
+    explicit AcquisitionBase(uint32_t rateHz) : _rateHz(rateHz ? rateHz : 1) {}
+
+    size_t readBlock(AcquiredSample* out, size_t maxCount) override {
+        return _ring.readBlock(out, maxCount);
+    }
+    size_t available() const override { return _ring.available(); }
+    size_t dropped() const override { return _ring.dropped(); }
+    uint32_t sampleRateHz() const override { return _rateHz; }
+
+protected:
+    SampleRing<AcquiredSample, kRingCapacity> _ring;
+    uint32_t _rateHz;
+};
@@ -0,0 +1,80 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include "SampleRing.h"
+#include "../Types.h"
+
+#if !defined(ARDUINO)
+#include <thread>
+#endif
+
+// Types.h declares namespace WindVane, which clashes with the global
+// WindVane class; code using both must keep them in separate translation
+// units and pass directions across as plain degrees.
+namespace WindVane {
+
+// One queued reading. Unlike WindMeasurement, which rounds to whole
+// degrees, the direction keeps the mapped float value.
+struct DirectionMeasurement {
+    float degrees{0.0f}; ///< [0, 360)
+    TimeMs timestamp{0};
+    bool isValid{false};
+};
+
+// Measurements flow from one sampling thread/task to one consumer per
+// queue; consumers that need their own pace each get their own queue.
+// Library-only for now: App still reads the vane directly from its loop.
+constexpr size_t kMeasurementQueueCapacity = 256;
+using MeasurementQueue = SampleRing<DirectionMeasurement, kMeasurementQueueCapacity>;
+
+// Producer side: samples a direction source and fans each measurement out
+// to the registered queues. A full queue drops only for its own consumer,
+// so a stalled console never holds up the logger or acquisition itself.
+class MeasurementPublisher {
+public:
+    static constexpr size_t kMaxConsumers = 4;
+    // Returns false when the reading is not valid (e.g. uncalibrated)
+    using ReadFn = bool (*)(void* context, float& degrees);
+
+    MeasurementPublisher(ReadFn read, void* context) : _read(read), _context(context) {}
+    virtual ~MeasurementPublisher() = default;
+
+    // Register before sampling starts
+    bool addConsumer(MeasurementQueue& queue);
+
+    // Takes one measurement and publishes it; call from the producer only
+    void sample(TimeMs now);
+
+    uint32_t published() const { return _published.load(std::memory_order_relaxed); }
+
+private:
+    ReadFn _read;
+    void* _context;
+    std::array<MeasurementQueue*, kMaxConsumers> _queues{};
+    size_t _queueCount{0};
+    std::atomic<uint32_t> _published{0};
+};
+
+#if !defined(ARDUINO)
+// Host sampling thread calling sample() at a fixed rate, scheduled like
+// ThreadedAcquisition. On the ESP32 a FreeRTOS task calls sample() instead.
+class ThreadedMeasurementSampler final : public MeasurementPublisher {
+public:
+    ThreadedMeasurementSampler(ReadFn read, void* context, uint32_t rateHz);
+    ~ThreadedMeasurementSampler() override;
+
+    bool start();
+    void stop();
+    bool running() const { return _thread.joinable(); }
+
+private:
+    uint32_t _rateHz;
+    std::atomic<bool> _stop{false};
+    std::thread _thread;
+
+    void run();
+};
+#endif
+
+} // namespace WindVane
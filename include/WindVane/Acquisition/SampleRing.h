@@ -0,0 +1,64 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// Lock-free single-producer/single-consumer ring. The producer (an
+// acquisition thread, task or ISR) calls push(); one consumer drains with
+// readBlock(). When full, new items are dropped and counted so the
+// producer never blocks.
+template <typename T, size_t Capacity>
+class SampleRing {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                  "capacity must be a power of two");
+
+public:
+    static constexpr size_t kCapacity = Capacity;
+
+    // Producer side
+    bool push(const T& item) {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        const size_t tail = _tail.load(std::memory_order_acquire);
+        if (head - tail == Capacity) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        _items[head & kMask] = item;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: moves up to maxCount of the oldest items into out
+    size_t readBlock(T* out, size_t maxCount) {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        const size_t head = _head.load(std::memory_order_acquire);
+        const size_t count = std::min(head - tail, maxCount);
+        const size_t first = tail & kMask;
+        const size_t split = std::min(count, Capacity - first);
+        std::copy_n(_items.begin() + first, split, out);
+        std::copy_n(_items.begin(), count - split, out + split);
+        _tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // Consumer side: discards everything currently queued
+    void clear() {
+        _tail.store(_head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    size_t available() const {
+        return _head.load(std::memory_order_acquire) -
+               _tail.load(std::memory_order_acquire);
+    }
+    size_t dropped() const { return _dropped.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr size_t kMask = Capacity - 1;
+
+    std::array<T, Capacity> _items{};
+    // Producer and consumer indices on separate cache lines
+    alignas(64) std::atomic<size_t> _head{0};
+    alignas(64) std::atomic<size_t> _tail{0};
+    std::atomic<size_t> _dropped{0};
+};
@@ -0,0 +1,27 @@
+#pragma once
+#if !defined(ARDUINO)
+#include <atomic>
+#include <thread>
+#include "IAcquisition.h"
+#include "../IADC.h"
+
+// Host acquisition: a thread samples any IADC at a fixed rate. Deadlines
+// advance by whole periods, so the rate does not drift with read cost;
+// after an overrun the schedule restarts rather than bursting to catch up.
+class ThreadedAcquisition final : public AcquisitionBase {
+public:
+    ThreadedAcquisition(IADC& adc, uint32_t rateHz);
+    ~ThreadedAcquisition() override;
+
+    bool start() override;
+    void stop() override;
+    bool running() const override { return _thread.joinable(); }
+
+private:
+    IADC& _adc;
+    std::atomic<bool> _stop{false};
+    std::thread _thread;
+
+    void run();
+};
+#endif
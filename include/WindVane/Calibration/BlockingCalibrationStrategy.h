@@ -0,0 +1,31 @@
+#pragma once
+#include "ICalibrationStrategy.h"
+
+// Session adapter for strategies that only implement a blocking
+// calibrate(): the first step() runs it to completion.
+class BlockingCalibrationStrategy : public ICalibrationStrategy {
+ public:
+  void beginSession(platform::TimeMs now) override {
+    (void)now;
+    _status = SessionStatus::Running;
+  }
+  bool step(platform::TimeMs now) override {
+    (void)now;
+    if (_status != SessionStatus::Running) return false;
+    calibrate();
+    _status = SessionStatus::Finished;
+    return false;
+  }
+  void abortSession() override {
+    if (_status == SessionStatus::Running) _status = SessionStatus::Aborted;
+  }
+  void finishSession() override {}
+  CalibrationProgress progress() const override {
+    CalibrationProgress p;
+    p.status = _status;
+    return p;
+  }
+
+ private:
+  SessionStatus _status{SessionStatus::Idle};
+};
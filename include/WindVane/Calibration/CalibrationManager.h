@@ -20,9 +20,24 @@ public:
   // Runs the full calibration process in a single step
   CalibrationResult runCalibration();
 
+  // Non-blocking alternative to runCalibration: start a session, then call
+  // stepSession() from the main loop until it returns false.
+  CalibrationResult startSession(platform::TimeMs now);
+  bool stepSession(platform::TimeMs now);
+  void abortSession();
+  void finishSession();
+  CalibrationProgress sessionProgress() const;
+
   // Converts a raw wind reading to calibrated degrees
   float getCalibratedData(float rawWindDirection) const;
 
+  // Converts count raw readings to calibrated degrees in one call
+  void getCalibratedData(const float* rawReadings, float* degrees,
+                         size_t count) const;
+
+  // Integer path: raw 12-bit ADC code to hundredths of a degree (0-35999)
+  uint16_t getCalibratedCentidegrees(uint16_t rawCode) const;
+
   // Allows editing the calibration data at certain points
   void editCalibrationData(/*data*/);
 
@@ -34,4 +49,7 @@ public:
 private:
   std::unique_ptr<ICalibrationStrategy> calibrationStrategy;
   CalibrationStatus status;
+  CalibrationStatus statusBeforeSession{CalibrationStatus::NotStarted};
+
+  void updateSessionStatus();
 };
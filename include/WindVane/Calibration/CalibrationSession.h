@@ -0,0 +1,20 @@
+#pragma once
+#include <cstddef>
+#include <Platform/TimeUtils.h>
+
+// State of a step-driven calibration session.
+enum class SessionStatus {
+  Idle,     ///< No session has been started
+  Running,  ///< Collecting samples; keep calling step()
+  Finished, ///< Completed and saved
+  Aborted   ///< Stopped without saving; previous calibration kept
+};
+
+// Snapshot of a session for status lines and progress displays.
+struct CalibrationProgress {
+  SessionStatus status{SessionStatus::Idle};
+  size_t detected{0};        ///< Positions found so far
+  size_t expected{0};        ///< Positions the session is looking for
+  int anomalies{0};          ///< Out-of-range readings rejected
+  platform::TimeMs elapsed{}; ///< Time since begin()
+};
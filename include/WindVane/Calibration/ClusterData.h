@@ -1,4 +1,5 @@
 #pragma once
+#include <stdint.h>
 
 struct ClusterData {
     float mean;
@@ -6,3 +7,12 @@ struct ClusterData {
     float max;
     int count;
 };
+
+// Q0.16 variant of ClusterData used by the fixed-point pipeline. mean, min
+// and max are fractions of ADC full scale multiplied by 65536.
+struct ClusterDataQ {
+    uint16_t mean;
+    uint16_t min;
+    uint16_t max;
+    uint16_t count;
+};
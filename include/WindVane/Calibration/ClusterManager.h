@@ -1,24 +1,126 @@
 #pragma once
 #include "ClusterData.h"
+#include "FixedPoint.h"
 #include "../Diagnostics/IDiagnostics.h"
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
-class ClusterManager {
+// Capacity of the default ClusterManager and upper bound for
+// SpinningConfig::expectedPositions. Override with -DWINDVANE_MAX_CLUSTERS=N.
+#ifndef WINDVANE_MAX_CLUSTERS
+#define WINDVANE_MAX_CLUSTERS 64
+#endif
+
+// Read-only view over a contiguous run of elements (std::span is C++20).
+template <typename T>
+class ArrayView {
+public:
+    ArrayView(const T* data, size_t size) : _data(data), _size(size) {}
+    const T* data() const { return _data; }
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    const T* begin() const { return _data; }
+    const T* end() const { return _data + _size; }
+    const T& operator[](size_t i) const { return _data[i]; }
+    const T& front() const { return _data[0]; }
+    const T& back() const { return _data[_size - 1]; }
+private:
+    const T* _data;
+    size_t _size;
+};
+
+// Cluster algorithms over storage supplied by the derived class. Nothing
+// here allocates: clusters are merged and pruned in place and the lookup
+// table is a member array. Use BasicClusterManager<N> or ClusterManager.
+class ClusterManagerBase {
 public:
+    // One table entry per 12-bit ADC code (see ESP32ADC::read)
+    static constexpr size_t kLookupSize = 4096;
+
+    ClusterManagerBase(const ClusterManagerBase&) = delete;
+    ClusterManagerBase& operator=(const ClusterManagerBase&) = delete;
+
     void clear();
+    // Returns true when a new cluster was created; readings that would need
+    // a cluster beyond capacity() are dropped and counted in overflows().
     bool addOrUpdate(float reading, float threshold);
     void mergeAndPrune(float mergeThreshold, int minCount);
     void diagnostics(IDiagnostics &diag) const;
-    void setClusters(const std::vector<ClusterData>& clusters);
+    // Copies at most capacity() clusters; returns false if any were dropped
+    bool setClusters(const ClusterData* clusters, size_t count);
+    bool setClusters(const std::vector<ClusterData>& clusters) {
+        return setClusters(clusters.data(), clusters.size());
+    }
     // reading is expected in the range [0,1]
     float interpolate(float reading) const;
-    const std::vector<ClusterData>& clusters() const { return _clusters; }
+    // Walks the clusters to find the bracketing pair; used while the
+    // lookup table is stale and as the reference for benchmarks.
+    float interpolateScan(float reading) const;
+    // Maps a quantized ADC code through the compiled lookup table
+    float lookup(uint16_t code) const;
+    // Maps count readings into degrees in one pass. With a compiled table
+    // each output equals interpolate() for readings in [0,1]; readings
+    // outside that range are clamped instead of wrapped.
+    void interpolateBatch(const float* readings, float* degrees, size_t count) const;
+    // Integer pipeline: ADC code through the Q0.16 cluster boundaries to an
+    // angle in hundredths of a degree (0-35999). Needs no FPU.
+    uint16_t interpolateCode(uint16_t code) const;
+    bool hasLookup() const { return _lookupValid; }
+    ArrayView<ClusterData> clusters() const { return {_clusters, _count}; }
+    ArrayView<ClusterDataQ> fixedClusters() const { return {_fixed, _fixedCount}; }
+    size_t capacity() const { return _capacity; }
     int anomalies() const { return _anomalyCount; }
+    int overflows() const { return _overflowCount; }
     void recordAnomaly() { ++_anomalyCount; }
+
+protected:
+    ClusterManagerBase(ClusterData* clusters, ClusterDataQ* fixed, size_t capacity)
+        : _clusters(clusters), _fixed(fixed), _capacity(capacity) {}
+    ~ClusterManagerBase() = default;
+
 private:
-    std::vector<ClusterData> _clusters;
+    ClusterData* _clusters;
+    ClusterDataQ* _fixed;
+    size_t _capacity;
+    size_t _count{0};
+    size_t _fixedCount{0};
+#if !WINDVANE_FIXED_POINT
+    float _lookup[kLookupSize];
+#endif
+    bool _lookupValid{false};
     int _anomalyCount{0};
+    int _overflowCount{0};
+
+    void compileLookup();
+};
+
+namespace detail {
+// Held as the first base so the buffers exist before ClusterManagerBase
+// receives pointers to them.
+template <size_t MaxClusters>
+struct ClusterStorage {
+    std::array<ClusterData, MaxClusters> _storage{};
+    std::array<ClusterDataQ, MaxClusters> _fixedStorage{};
+};
+} // namespace detail
+
+// Cluster manager with inline storage for MaxClusters clusters.
+template <size_t MaxClusters>
+class BasicClusterManager final : private detail::ClusterStorage<MaxClusters>,
+                                  public ClusterManagerBase {
+    static_assert(MaxClusters > 0, "cluster capacity must be positive");
+    static_assert(MaxClusters <= 0xFFFF, "cluster count is persisted as uint16_t");
+
+public:
+    static constexpr size_t kCapacity = MaxClusters;
+
+    BasicClusterManager()
+        : ClusterManagerBase(this->_storage.data(), this->_fixedStorage.data(),
+                             MaxClusters) {}
 };
 
+using ClusterManager = BasicClusterManager<WINDVANE_MAX_CLUSTERS>;
@@ -0,0 +1,39 @@
+#pragma once
+#include <stdint.h>
+
+// Selects the integer mapping pipeline for targets without an FPU. Define
+// WINDVANE_FIXED_POINT=1 in the build flags to force it on other targets.
+#ifndef WINDVANE_FIXED_POINT
+#if defined(__AVR__)
+#define WINDVANE_FIXED_POINT 1
+#else
+#define WINDVANE_FIXED_POINT 0
+#endif
+#endif
+
+namespace fixed_point {
+
+constexpr uint16_t kMaxCode = 4095;               ///< 12-bit ADC full scale
+constexpr uint32_t kQ16One = 65536UL;             ///< 1.0 in Q0.16
+constexpr uint32_t kCentidegreesPerRev = 36000UL; ///< 360.00 degrees
+
+/// Converts a reading in [0,1] to Q0.16, saturating below 1.0.
+inline uint16_t toQ16(float value) {
+    if (!(value > 0.0f)) return 0;
+    if (value >= 1.0f) return 0xFFFF;
+    uint32_t q = static_cast<uint32_t>(value * static_cast<float>(kQ16One) + 0.5f);
+    return q > 0xFFFF ? 0xFFFF : static_cast<uint16_t>(q);
+}
+
+inline float fromQ16(uint16_t q) {
+    return static_cast<float>(q) / static_cast<float>(kQ16One);
+}
+
+/// Maps an ADC code onto the same Q0.16 scale as the cluster boundaries;
+/// full scale (4095) maps to exactly 1.0, matching code / 4095.0f.
+inline uint32_t codeToQ16(uint16_t code) {
+    if (code > kMaxCode) code = kMaxCode;
+    return (static_cast<uint32_t>(code) * kQ16One + kMaxCode / 2) / kMaxCode;
+}
+
+} // namespace fixed_point
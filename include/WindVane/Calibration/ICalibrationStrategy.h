@@ -6,12 +6,42 @@ enum class CalibrationStrategyType {
 };
 
 #include "../CalibrationConfig.h"
+#include "../CalibrationSession.h"
+#include <cstddef>
+#include <stdint.h>
 
 class ICalibrationStrategy {
  public:
   virtual ~ICalibrationStrategy() = default;
   virtual void calibrate() = 0;
+
+  // Step-driven session. Call beginSession() once, then step() from the
+  // main loop until it returns false. Strategies without a state machine
+  // can derive from BlockingCalibrationStrategy instead.
+  virtual void beginSession(platform::TimeMs now) = 0;
+  virtual bool step(platform::TimeMs now) = 0;
+  // Ends the session without saving
+  virtual void abortSession() = 0;
+  // Ends the session early and keeps what has been collected
+  virtual void finishSession() = 0;
+  virtual CalibrationProgress progress() const = 0;
+
   virtual float mapReading(float reading) const = 0;
+  // Maps a contiguous buffer of readings; strategies override this to avoid
+  // a virtual call per sample.
+  virtual void mapReadings(const float* readings, float* degrees,
+                           size_t count) const {
+    for (size_t i = 0; i < count; ++i) degrees[i] = mapReading(readings[i]);
+  }
+  // Maps a raw 12-bit ADC code to hundredths of a degree (0-35999)
+  virtual uint16_t mapCode(uint16_t code) const {
+    const float deg = mapReading(code / 4095.0f);
+    // Out-of-range or NaN degrees would make the integer cast undefined
+    if (!(deg > 0.0f)) return 0;
+    if (deg >= 360.0f) return 0;
+    return static_cast<uint16_t>(
+        static_cast<uint32_t>(deg * 100.0f + 0.5f) % 36000UL);
+  }
   virtual CalibrationStrategyType strategyType() const = 0;
   virtual void setConfig(const CalibrationConfig& cfg) = 0;
   virtual CalibrationConfig config() const = 0;
@@ -1,6 +1,8 @@
 #pragma once
 
 struct SpinningConfig {
+  static constexpr int kMaxBufferSize = 100; ///< Largest accepted bufferSize
+
   float threshold = 0.05f;      ///< Minimum delta to consider a new position
   int bufferSize = 5;           ///< Number of samples for noise filtering
   int expectedPositions = 16;   ///< Expected number of detent positions
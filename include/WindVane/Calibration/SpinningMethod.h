@@ -1,11 +1,10 @@
 #pragma once
 #include "ICalibrationStrategy.h"
-#include <deque>
 #include <vector>
 #include <cstdint>
-#include <chrono>
 #include "../ClusterData.h"
 #include "../ClusterManager.h"
+#include "../NoiseWindow.h"
 #include "../SpinningConfig.h"
 #include "../CalibrationConfig.h"
 #include "../../Storage/ICalibrationStorage.h"
@@ -13,6 +12,11 @@
 
 class IADC;
 
+static_assert(SpinningConfig{}.expectedPositions <=
+                  static_cast<int>(ClusterManager::kCapacity),
+              "default expectedPositions exceeds ClusterManager capacity; "
+              "raise WINDVANE_MAX_CLUSTERS");
+
 // Implements a spinning calibration strategy that records unique positions
 // while the user rotates the vane.
 
@@ -31,11 +35,23 @@ public:
     return CalibrationStrategyType::Spinning;
   }
 
-  // Runs the interactive calibration procedure.
+  // Runs the interactive calibration procedure, blocking until it ends.
   void calibrate() override;
 
+  // Non-blocking session: one ADC sample per sampleDelayMs of `now`.
+  // Stall detection uses the supplied time too, so sessions can be driven
+  // faster than real time.
+  void beginSession(platform::TimeMs now) override;
+  bool step(platform::TimeMs now) override;
+  void abortSession() override;
+  void finishSession() override;
+  CalibrationProgress progress() const override;
+
   // Map a raw ADC reading to a calibrated direction in degrees
   float mapReading(float reading) const override;
+  void mapReadings(const float* readings, float* degrees,
+                   size_t count) const override;
+  uint16_t mapCode(uint16_t code) const override;
 
   CalibrationConfig config() const override {
     CalibrationConfig cfg;
@@ -51,7 +67,9 @@ private:
   ICalibrationStorage& _storage;
   IDiagnostics& _diag;
   ClusterManager _clusterMgr;
-  std::deque<float> _recent;
+  NoiseWindow _recent;
+  // Reserved to ClusterManager capacity so saving does not allocate
+  mutable std::vector<ClusterData> _saveBuffer;
   SpinningConfig _config;
 
   struct SessionState {
@@ -59,18 +77,22 @@ private:
     bool stop{false};
     bool abort{false};
     float prevReading{-1.0f};
-    std::chrono::steady_clock::time_point lastIncrease{std::chrono::steady_clock::now()};
+    platform::TimeMs started{};
+    platform::TimeMs sampleTime{};   ///< Time of the reading being processed
+    platform::TimeMs nextSample{};
+    platform::TimeMs lastIncrease{};
   };
+  SessionState _session;
+  SessionStatus _status{SessionStatus::Idle};
 
   void saveCalibration() const;
+  void loadCalibration();
 
-  bool checkStall(std::chrono::steady_clock::time_point now,
-                  std::chrono::steady_clock::time_point &last,
-                  const std::chrono::seconds &timeout) const;
+  bool checkStall(platform::TimeMs now, platform::TimeMs last,
+                  platform::TimeMs timeout) const;
   void updateClusters(float reading, SessionState &state);
   void finalizeCalibration(bool abort, float mergeThreshold);
-  void runSession(SessionState &state, std::chrono::milliseconds delay,
-                  std::chrono::seconds timeout);
+  void endSession();
   void processReading(float reading, SessionState &state);
   void initSession(SessionState &state);
 };
@@ -9,6 +9,7 @@ public:
   int getPin() const { return _pin; }
 
   float read() const override;
+  uint16_t readCode() const override;
 
 private:
   int _pin;
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <stdint.h>
+#include "../../IADC.h"
+
+/**
+ * Scripted vane motion, advanced one step per ADC sample. Angles are in
+ * degrees and wrap at 360.
+ */
+class RotationScript {
+public:
+  // Stays at `deg` for `samples` reads
+  RotationScript& hold(float deg, uint32_t samples);
+  // Moves linearly from `fromDeg` to `toDeg` over `samples` reads; the
+  // direction of travel follows the sign of toDeg - fromDeg
+  RotationScript& sweep(float fromDeg, float toDeg, uint32_t samples);
+  // Full turns starting at `startDeg`; negative turns spin backwards
+  RotationScript& spin(float startDeg, float turns, uint32_t samples);
+  // Restart from the first segment after the last one; otherwise the
+  // final angle is held
+  RotationScript& loop(bool enable = true);
+
+  bool empty() const { return _segments.empty(); }
+
+private:
+  friend class SimulatedVaneADC;
+  struct Segment {
+    float start;
+    float step;
+    uint32_t samples;
+  };
+  std::vector<Segment> _segments;
+  bool _loop{false};
+};
+
+/** Electrical and mechanical model parameters. */
+struct SimulatedVaneConfig {
+  /// Reed switch resistors, evenly spaced from 0 degrees. The default is the
+  /// common 8-switch ladder (Argent/SparkFun style) which yields 16 positions.
+  std::vector<float> resistorsOhms{33000.0f, 8200.0f, 1000.0f, 2200.0f,
+                                   3900.0f, 16000.0f, 120000.0f, 64900.0f};
+  float pullupOhms = 10000.0f;     ///< Divider resistor to the supply
+  /// Half-width of each switch's closed zone. Above half the switch spacing,
+  /// neighbouring switches overlap and close together (extra positions);
+  /// below it the vane passes through open-circuit gaps.
+  float closeHalfWidthDeg = 25.0f;
+  float noiseCodes = 2.0f;         ///< ADC noise, standard deviation in codes
+  /// Bow-shaped integral nonlinearity, as a fraction of full scale at mid-scale
+  float nonlinearity = 0.01f;
+  /// Input fraction of the supply at which the ADC saturates (the ESP32
+  /// with 11 dB attenuation clips near 0.95)
+  float saturation = 0.95f;
+  uint32_t bounceSamples = 3;      ///< Reads of contact bounce after a change
+  uint64_t seed = 0x9E3779B97F4A7C15ULL;
+};
+
+/**
+ * IADC backed by a reed-switch resistor ladder model instead of hardware.
+ * Each read advances the rotation script by one step, so calibration and
+ * mapping code can be exercised at millions of samples per second.
+ */
+class SimulatedVaneADC : public IADC {
+public:
+  explicit SimulatedVaneADC(const SimulatedVaneConfig& cfg = SimulatedVaneConfig{});
+
+  float read() const override { return readCode() / 4095.0f; }
+  uint16_t readCode() const override;
+
+  void setScript(const RotationScript& script);
+  // Parks the vane at `deg`, replacing any script
+  void setAngle(float deg);
+  float angle() const { return _angle; }
+
+  // Stable positions the ladder can report (single and paired switches)
+  size_t positions() const;
+  // Noise- and bounce-free code for a vane parked at `deg`
+  uint16_t idealCode(float deg) const;
+
+private:
+  SimulatedVaneConfig _cfg;
+  float _spacingDeg;
+  std::vector<float> _stateCodes; ///< Singles, then pairs, then open circuit
+  RotationScript _script;
+
+  mutable float _angle{0.0f};
+  mutable size_t _segment{0};
+  mutable uint32_t _offset{0};
+  mutable size_t _settled;
+  mutable uint32_t _bounceLeft{0};
+  mutable uint64_t _rng;
+  mutable bool _bounceBit{false};
+
+  size_t openState() const { return _stateCodes.size() - 1; }
+  size_t classify(float deg) const;
+  float toCode(float ohms) const;
+  void advance() const;
+  float gaussian() const;
+};
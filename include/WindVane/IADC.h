@@ -1,6 +1,15 @@
 #pragma once
+#include <stdint.h>
 class IADC {
 public:
     virtual ~IADC() = default;
     virtual float read() const = 0;
+    // Raw 12-bit code (0-4095); drivers override this to skip the float path
+    virtual uint16_t readCode() const {
+        const float v = read();
+        // Negated compare so NaN lands on 0 rather than an undefined cast
+        if (!(v > 0.0f)) return 0;
+        if (v >= 1.0f) return 4095;
+        return static_cast<uint16_t>(v * 4095.0f + 0.5f);
+    }
 };
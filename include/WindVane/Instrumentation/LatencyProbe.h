@@ -0,0 +1,99 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <stdint.h>
+#include <Platform/TimeUtils.h>
+
+// Build flag for the WINDVANE_PROBE timers; off by default so release
+// and benchmark builds carry no clock reads.
+#ifndef WINDVANE_LATENCY_PROBES
+#define WINDVANE_LATENCY_PROBES 0
+#endif
+
+// Instrumented stages. Names are shown by the diagnostics menu.
+enum class Probe : uint8_t {
+    AdcRead,
+    Interpolate,
+    StatusLine,
+    StorageSave,
+    MenuUpdate,
+    Count
+};
+
+const char* probeName(Probe probe);
+
+// Log-bucketed latency histogram in microseconds: four sub-buckets per
+// power of two, so percentiles are within ~19% of the true value and the
+// full 32-bit range fits in 128 counters. Recording is wait-free.
+class LatencyHistogram {
+public:
+    static constexpr size_t kSubBits = 2;
+    static constexpr size_t kBuckets = (32 - kSubBits + 1) << kSubBits;
+
+    void record(uint32_t us);
+    void reset();
+
+    uint32_t count() const { return _count.load(std::memory_order_relaxed); }
+    uint32_t max() const { return _max.load(std::memory_order_relaxed); }
+    // Upper bound of the bucket holding the given fraction of samples
+    uint32_t percentile(float fraction) const;
+
+    static size_t bucketFor(uint32_t us);
+    static uint32_t bucketUpperBound(size_t bucket);
+
+private:
+    std::array<std::atomic<uint32_t>, kBuckets> _buckets{};
+    std::atomic<uint32_t> _count{0};
+    std::atomic<uint32_t> _max{0};
+};
+
+struct ProbeSummary {
+    const char* name;
+    uint32_t count;
+    uint32_t p50Us;
+    uint32_t p99Us;
+    uint32_t maxUs;
+};
+
+// Process-wide histograms, one per Probe.
+class LatencyProbes {
+public:
+    static LatencyProbes& instance();
+
+    void record(Probe probe, uint32_t us) { _histograms[index(probe)].record(us); }
+    const LatencyHistogram& histogram(Probe probe) const { return _histograms[index(probe)]; }
+    ProbeSummary summary(Probe probe) const;
+    // Menu iterations per second since the last reset. Measured in
+    // milliseconds, so it stays valid for ~49 days rather than the
+    // ~71 minutes a 32-bit microsecond span lasts.
+    float loopRateHz(platform::TimeMs now) const;
+    void reset();
+
+private:
+    std::array<LatencyHistogram, static_cast<size_t>(Probe::Count)> _histograms;
+    std::atomic<uint32_t> _sinceMs{platform::toEmbedded(platform::now())};
+
+    static size_t index(Probe probe) { return static_cast<size_t>(probe); }
+};
+
+// Records the lifetime of the enclosing scope against a probe
+class ScopedLatency {
+public:
+    explicit ScopedLatency(Probe probe) : _probe(probe), _start(platform::nowUs()) {}
+    ~ScopedLatency() { LatencyProbes::instance().record(_probe, platform::nowUs() - _start); }
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+private:
+    Probe _probe;
+    uint32_t _start;
+};
+
+#define WINDVANE_PROBE_CONCAT_(a, b) a##b
+#define WINDVANE_PROBE_NAME_(line) WINDVANE_PROBE_CONCAT_(wvProbe_, line)
+#if WINDVANE_LATENCY_PROBES
+#define WINDVANE_PROBE(stage) ScopedLatency WINDVANE_PROBE_NAME_(__LINE__)(Probe::stage)
+#else
+#define WINDVANE_PROBE(stage) static_cast<void>(0)
+#endif
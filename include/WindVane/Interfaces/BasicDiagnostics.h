@@ -1,16 +1,23 @@
 #pragma once
 #include "IDiagnosticsSink.h"
 #include <UI/IIO.h>
+#include <cstdio>
 
 class BasicDiagnostics final : public IDiagnosticsSink {
 public:
     explicit BasicDiagnostics(IOutput* out) : _out(out) {}
     void handle(const DiagnosticsEvent& ev) override {
         if (!_out) return;
-        const char* lvl = ev.level == LogLevel::Info ? "INFO" : "WARN";
         char buf[128];
-        snprintf(buf, sizeof(buf), "[%u] %s: %s",
-                 platform::toEmbedded(ev.timestamp), lvl, ev.message.c_str());
+        int n = snprintf(buf, sizeof(buf), "[%u] %s: ",
+                         platform::toEmbedded(ev.timestamp), levelName(ev.level));
+        if (const char* text = ev.plainText()) {
+            // Plain text goes out whole rather than through the line buffer
+            if (n > 0 && static_cast<size_t>(n) < sizeof(buf)) _out->write(buf);
+            _out->writeln(text);
+            return;
+        }
+        if (n > 0 && static_cast<size_t>(n) < sizeof(buf)) ev.render(buf + n, sizeof(buf) - n);
         _out->writeln(buf);
     }
 private:
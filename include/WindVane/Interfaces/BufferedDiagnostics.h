@@ -2,34 +2,31 @@
 #include "IDiagnosticsSink.h"
 #include "IDiagnostics.h"
 #include <UI/IIO.h>
-#include <deque>
-#include <string>
+#include <memory>
 
+// Keeps the last maxEntries log lines in a ring of fixed-size records
+// allocated once at construction, so long uptimes never churn the heap.
+// When an output is given, lines are echoed to it and the history's
+// memory footprint is reported there at construction.
 class BufferedDiagnostics final : public IDiagnosticsSink, public IBufferedDiagnostics {
 public:
-    explicit BufferedDiagnostics(size_t maxEntries = 10, IOutput* out = nullptr)
-        : _maxEntries(maxEntries), _out(out) {}
+    explicit BufferedDiagnostics(size_t maxEntries = 10, IOutput* out = nullptr);
 
-    void handle(const DiagnosticsEvent& ev) override {
-        std::string lvl = ev.level == LogLevel::Info ? "INFO" : "WARN";
-        std::string msg = "[" + std::to_string(platform::toEmbedded(ev.timestamp)) + "] " + lvl + ": " + ev.message;
-        if (_out)
-            _out->writeln(msg.c_str());
-        push(msg);
-    }
+    void handle(const DiagnosticsEvent& ev) override;
 
-    const std::deque<std::string>& history() const override { return _messages; }
+    size_t size() const override { return _count; }
+    const DiagnosticsRecord& at(size_t index) const override {
+        return _records[(_head + _capacity - _count + index) % _capacity];
+    }
+    void clear() override { _count = 0; }
 
-    void clear() override { _messages.clear(); }
+    size_t capacity() const { return _capacity; }
+    size_t memoryBytes() const { return _capacity * sizeof(DiagnosticsRecord); }
 
 private:
-    size_t _maxEntries;
-    std::deque<std::string> _messages;
+    size_t _capacity;
+    std::unique_ptr<DiagnosticsRecord[]> _records;
+    size_t _head{0};  ///< Next slot to write
+    size_t _count{0};
     IOutput* _out;
-
-    void push(const std::string& m) {
-        if (_messages.size() >= _maxEntries)
-            _messages.pop_front();
-        _messages.push_back(m);
-    }
 };
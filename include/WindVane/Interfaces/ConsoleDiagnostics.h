@@ -5,7 +5,13 @@
 class ConsoleDiagnostics : public IDiagnosticsSink {
 public:
     void handle(const DiagnosticsEvent& ev) override {
-        const char* lvl = ev.level == LogLevel::Info ? "INFO" : "WARN";
-        std::cout << '[' << platform::toEmbedded(ev.timestamp) << "] " << lvl << ": " << ev.message << std::endl;
+        char buf[128];
+        const char* text = ev.plainText();
+        if (!text) {
+            ev.render(buf, sizeof(buf));
+            text = buf;
+        }
+        std::cout << '[' << platform::toEmbedded(ev.timestamp) << "] " << levelName(ev.level)
+                  << ": " << text << std::endl;
     }
 };
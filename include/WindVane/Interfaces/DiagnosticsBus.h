@@ -1,24 +1,105 @@
 #pragma once
 #include "IDiagnostics.h"
 #include "IDiagnosticsSink.h"
+#include "MpscQueue.h"
 #include <algorithm>
+#include <atomic>
+#include <memory>
 #include <vector>
 
+#if !defined(ARDUINO)
+#include <thread>
+#endif
+
+// Fans diagnostics out to sinks. By default sinks run on the caller's
+// thread. In async mode callers only enqueue; drain() (or the host drain
+// thread) delivers to sinks, so a slow console never blocks sampling.
+// Destruction delivers anything still queued on every target.
+// Each sink has a level mask, so a console can stay at Warn while a file
+// sink records Debug. Sinks must be configured before async mode starts.
 class DiagnosticsBus : public IDiagnostics {
 public:
-    void addSink(IDiagnosticsSink* sink) { if (sink) _sinks.push_back(sink); }
-    void removeSink(IDiagnosticsSink* sink) {
-        _sinks.erase(std::remove(_sinks.begin(), _sinks.end(), sink), _sinks.end());
+    static constexpr size_t kQueueCapacity = 64;
+
+    ~DiagnosticsBus() override;
+
+    static constexpr uint8_t kAllLevels = levelsFrom(LogLevel::Debug);
+
+    void addSink(IDiagnosticsSink* sink, uint8_t levelMask = kAllLevels);
+    void removeSink(IDiagnosticsSink* sink);
+    // Replaces the sink's mask of levelBit() flags
+    void setSinkLevels(IDiagnosticsSink* sink, uint8_t levelMask);
+    // Shorthand for a mask of `minimum` and everything above it
+    void setSinkLevel(IDiagnosticsSink* sink, LogLevel minimum) {
+        setSinkLevels(sink, levelsFrom(minimum));
+    }
+
+    void info(const char* msg) override { logPlain(LogLevel::Info, msg); }
+    void warn(const char* msg) override { logPlain(LogLevel::Warn, msg); }
+    void debug(const char* msg) override { logPlain(LogLevel::Debug, msg); }
+    void error(const char* msg) override { logPlain(LogLevel::Error, msg); }
+    // Events travel to sinks unformatted; only text sinks render them
+    void log(const DiagnosticsEvent& ev) override {
+        if (enabled(ev.level)) dispatch(ev);
     }
+    bool enabled(LogLevel level) const override { return _levels & levelBit(level); }
 
-    void info(const char* msg) override { dispatch(LogLevel::Info, msg); }
-    void warn(const char* msg) override { dispatch(LogLevel::Warn, msg); }
+    // Switches to queued delivery; the caller must then call drain()
+    // regularly (e.g. from a task) unless the host drain thread is used
+    void enableQueue();
+    // Delivers up to maxEvents queued events on the calling thread (the
+    // single consumer); returns how many were delivered
+    size_t drain(size_t maxEvents = kQueueCapacity);
+    // Events rejected because the queue was full
+    uint32_t dropped() const { return _dropped.load(std::memory_order_relaxed); }
+    bool queued() const { return _active.load(std::memory_order_acquire) != nullptr; }
+
+#if !defined(ARDUINO)
+    // Queued delivery with a drain thread on host
+    void startAsync();
+    // Waits until everything enqueued so far has reached the sinks. With
+    // the drain thread it only waits; after a bare enableQueue() it drains
+    // on the calling thread, so it must then be called from the consumer
+    // that otherwise calls drain(), never alongside it.
+    void flush();
+    // Joins the drain thread, delivers what is left and returns to
+    // synchronous delivery; also run by the destructor. Call once
+    // producers have quiesced, as at shutdown.
+    void stopAsync();
+    bool async() const { return _drainThread.joinable(); }
+#endif
 
 private:
-    std::vector<IDiagnosticsSink*> _sinks;
+    using Queue = MpscQueue<DiagnosticsEvent, kQueueCapacity>;
+
+    struct SinkEntry {
+        IDiagnosticsSink* sink;
+        uint8_t levels;
+    };
+
+    std::vector<SinkEntry> _sinks;
+    uint8_t _levels{0}; ///< Union of all sink masks
+    std::unique_ptr<Queue> _queue;       ///< Allocated once, on first use
+    std::atomic<Queue*> _active{nullptr}; ///< Set while delivery is queued
+    std::atomic<uint32_t> _dropped{0};
+    uint32_t _reportedDrops{0};
+    std::atomic<uint32_t> _accepted{0};
+    std::atomic<uint32_t> _delivered{0};
 
-    void dispatch(LogLevel level, const char* msg) {
-        DiagnosticsEvent ev{level, platform::now(), std::string(msg)};
-        for (auto* s : _sinks) if (s) s->handle(ev);
+    void logPlain(LogLevel level, const char* msg) {
+        if (enabled(level)) dispatch(DiagnosticsEvent::borrowed(level, msg));
     }
+    void dispatch(DiagnosticsEvent ev);
+    void deliver(const DiagnosticsEvent& ev) {
+        const uint8_t bit = levelBit(ev.level);
+        for (const auto& e : _sinks) if (e.levels & bit) e.sink->handle(ev);
+    }
+    void updateLevels();
+    // Returns to synchronous delivery and delivers what is still queued
+    void drainRemaining();
+
+#if !defined(ARDUINO)
+    std::atomic<bool> _stop{false};
+    std::thread _drainThread;
+#endif
 };
@@ -1,11 +1,100 @@
 #pragma once
-#include <string>
+#include <stddef.h>
+#include <stdint.h>
 #include <Platform/TimeUtils.h>
 
-enum class LogLevel { Info, Warn };
+enum class LogLevel : uint8_t { Debug, Info, Warn, Error };
 
+// Lowest level compiled into the WINDVANE_LOG_* macros: 0 Debug, 1 Info,
+// 2 Warn, 3 Error. Release builds keep the default and pay nothing for
+// debug tracing.
+#ifndef WINDVANE_MIN_LOG_LEVEL
+#define WINDVANE_MIN_LOG_LEVEL 1
+#endif
+constexpr LogLevel kMinLogLevel = static_cast<LogLevel>(WINDVANE_MIN_LOG_LEVEL);
+
+// Bit per level, for per-sink filtering
+constexpr uint8_t levelBit(LogLevel level) { return static_cast<uint8_t>(1u << static_cast<uint8_t>(level)); }
+// Mask admitting `level` and everything more severe
+constexpr uint8_t levelsFrom(LogLevel level) {
+    return static_cast<uint8_t>(0x0Fu & ~(levelBit(level) - 1u));
+}
+
+// One captured printf argument. Strings are kept by pointer, so only
+// literals or other static strings may be passed as arguments.
+struct DiagnosticsArg {
+    enum class Type : uint8_t { Int, Uint, Float, Str };
+    Type type;
+    union {
+        int32_t i;
+        uint32_t u;
+        float f;
+        const char* s;
+    };
+
+    DiagnosticsArg() : type(Type::Int), i(0) {}
+    DiagnosticsArg(int v) : type(Type::Int), i(v) {}
+    DiagnosticsArg(long v) : type(Type::Int), i(static_cast<int32_t>(v)) {}
+    DiagnosticsArg(long long v) : type(Type::Int), i(static_cast<int32_t>(v)) {}
+    DiagnosticsArg(unsigned v) : type(Type::Uint), u(v) {}
+    DiagnosticsArg(unsigned long v) : type(Type::Uint), u(static_cast<uint32_t>(v)) {}
+    DiagnosticsArg(unsigned long long v) : type(Type::Uint), u(static_cast<uint32_t>(v)) {}
+    DiagnosticsArg(float v) : type(Type::Float), f(v) {}
+    DiagnosticsArg(double v) : type(Type::Float), f(static_cast<float>(v)) {}
+    DiagnosticsArg(const char* v) : type(Type::Str), s(v) {}
+};
+
+// Fixed-size, trivially copyable diagnostics record. Structured events
+// carry a static format string (its address doubles as the format id) and
+// up to kMaxArgs typed arguments; nothing is rendered until a sink asks
+// for text. Plain messages delivered synchronously borrow the caller's
+// string and render in full; once queued they are copied, truncated to
+// kTextSize - 1 characters, into `text`.
 struct DiagnosticsEvent {
-    LogLevel level;
-    platform::TimeMs timestamp;
-    std::string message;
+    static constexpr size_t kMaxArgs = 6;
+    static constexpr size_t kTextSize = 48;
+
+    LogLevel level{LogLevel::Info};
+    platform::TimeMs timestamp{};
+    const char* format{nullptr}; ///< nullptr for plain text events
+    const char* message{nullptr}; ///< Borrowed plain text; see borrowed()
+    uint8_t argCount{0};
+    DiagnosticsArg args[kMaxArgs];
+    char text[kTextSize]{};
+
+    // Copies msg, truncated, so the event may outlive it
+    static DiagnosticsEvent plain(LogLevel level, const char* msg);
+    // Refers to msg without copying. Only valid while msg lives, i.e. for
+    // synchronous delivery; sinks that keep events past handle() must
+    // render them or call detach() first.
+    static DiagnosticsEvent borrowed(LogLevel level, const char* msg);
+    // Turns a borrowed event into a plain one
+    void detach();
+    // Text of a plain event, unbounded when borrowed; nullptr if structured
+    const char* plainText() const { return format ? nullptr : (message ? message : text); }
+
+    template <typename... Args>
+    static DiagnosticsEvent structured(LogLevel level, const char* fmt, Args... values) {
+        static_assert(sizeof...(Args) <= kMaxArgs, "too many diagnostics arguments");
+        DiagnosticsEvent ev;
+        ev.level = level;
+        ev.format = fmt;
+        ev.argCount = static_cast<uint8_t>(sizeof...(Args));
+        size_t i = 0;
+        (void)i;
+        ((ev.args[i++] = DiagnosticsArg(values)), ...);
+        return ev;
+    }
+
+    // Renders the message into buf (always terminated); returns its length
+    size_t render(char* buf, size_t size) const;
 };
+
+inline const char* levelName(LogLevel level) {
+    switch (level) {
+    case LogLevel::Debug: return "DEBUG";
+    case LogLevel::Info: return "INFO";
+    case LogLevel::Warn: return "WARN";
+    default: return "ERROR";
+    }
+}
@@ -1,17 +1,82 @@
 #pragma once
-#include <deque>
-#include <string>
+#include <stddef.h>
+#include <stdint.h>
+#include "DiagnosticsEvent.h"
 
 class IDiagnostics {
 public:
     virtual ~IDiagnostics() = default;
     virtual void info(const char* msg) = 0;
     virtual void warn(const char* msg) = 0;
+    virtual void debug(const char* msg) { log(DiagnosticsEvent::borrowed(LogLevel::Debug, msg)); }
+    virtual void error(const char* msg) { log(DiagnosticsEvent::borrowed(LogLevel::Error, msg)); }
+
+    // Structured event; implementations that can defer formatting override
+    // this, the default renders it and forwards Debug/Info to info() and
+    // Warn/Error to warn().
+    virtual void log(const DiagnosticsEvent& ev) {
+        char buf[128];
+        const char* text = ev.plainText();
+        if (!text) {
+            ev.render(buf, sizeof(buf));
+            text = buf;
+        }
+        if (ev.level >= LogLevel::Warn) warn(text);
+        else info(text);
+    }
+
+    // Whether anything listens at this level; lets callers skip building
+    // arguments. Used by the WINDVANE_LOG_* macros.
+    virtual bool enabled(LogLevel) const { return true; }
+
+    // printf-style logging without formatting at the call site; string
+    // arguments must outlive the event (use literals)
+    template <typename... Args>
+    void logf(LogLevel level, const char* fmt, Args... args) {
+        log(DiagnosticsEvent::structured(level, fmt, args...));
+    }
+    template <typename... Args>
+    void debugf(const char* fmt, Args... args) { logf(LogLevel::Debug, fmt, args...); }
+    template <typename... Args>
+    void infof(const char* fmt, Args... args) { logf(LogLevel::Info, fmt, args...); }
+    template <typename... Args>
+    void warnf(const char* fmt, Args... args) { logf(LogLevel::Warn, fmt, args...); }
+    template <typename... Args>
+    void errorf(const char* fmt, Args... args) { logf(LogLevel::Error, fmt, args...); }
+};
+
+// Level-filtered logging. Below WINDVANE_MIN_LOG_LEVEL the call is
+// discarded at compile time, arguments included; above it, arguments are
+// only evaluated when some sink accepts the level.
+#define WINDVANE_LOG_AT(diag, level, ...)                          \
+    do {                                                           \
+        if constexpr ((level) >= kMinLogLevel) {                   \
+            IDiagnostics& wvDiag_ = (diag);                        \
+            if (wvDiag_.enabled(level)) wvDiag_.logf((level), __VA_ARGS__); \
+        }                                                          \
+    } while (0)
+#define WINDVANE_LOG_DEBUG(diag, ...) WINDVANE_LOG_AT(diag, LogLevel::Debug, __VA_ARGS__)
+#define WINDVANE_LOG_INFO(diag, ...) WINDVANE_LOG_AT(diag, LogLevel::Info, __VA_ARGS__)
+#define WINDVANE_LOG_WARN(diag, ...) WINDVANE_LOG_AT(diag, LogLevel::Warn, __VA_ARGS__)
+#define WINDVANE_LOG_ERROR(diag, ...) WINDVANE_LOG_AT(diag, LogLevel::Error, __VA_ARGS__)
+
+// One retained log line; fixed size so histories are a single block
+struct DiagnosticsRecord {
+    static constexpr size_t kTextSize = 59;
+
+    uint32_t timestampMs;
+    LogLevel level;
+    char text[kTextSize]; ///< Rendered message, truncated
+
+    // Formats "[timestamp] LEVEL: text" into buf; returns its length
+    size_t format(char* buf, size_t size) const;
 };
 
 class IBufferedDiagnostics {
 public:
     virtual ~IBufferedDiagnostics() = default;
-    virtual const std::deque<std::string>& history() const = 0;
+    virtual size_t size() const = 0;
+    // Random access in arrival order; 0 is the oldest retained record
+    virtual const DiagnosticsRecord& at(size_t index) const = 0;
     virtual void clear() = 0;
 };
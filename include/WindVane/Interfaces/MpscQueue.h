@@ -0,0 +1,71 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <stdint.h>
+
+// Bounded lock-free multi-producer/single-consumer queue (Vyukov's
+// sequenced-cell design). Producers on any thread claim a cell with one
+// CAS; a full queue rejects the push instead of blocking.
+template <typename T, size_t Capacity>
+class MpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "capacity must be a power of two");
+
+public:
+    static constexpr size_t kCapacity = Capacity;
+
+    MpscQueue() {
+        for (size_t i = 0; i < Capacity; ++i) _cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    // Any thread
+    bool push(const T& item) {
+        size_t pos = _enqueue.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &_cells[pos & kMask];
+            const size_t seq = cell->seq.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueue.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = item;
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer thread only
+    bool pop(T& out) {
+        Cell& cell = _cells[_dequeue & kMask];
+        const size_t seq = cell.seq.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(_dequeue + 1) < 0) return false;
+        out = cell.value;
+        cell.seq.store(_dequeue + Capacity, std::memory_order_release);
+        ++_dequeue;
+        return true;
+    }
+
+    // Consumer thread only; a concurrent push may land right after
+    bool empty() const {
+        return _enqueue.load(std::memory_order_acquire) == _dequeue;
+    }
+
+private:
+    static constexpr size_t kMask = Capacity - 1;
+
+    struct Cell {
+        std::atomic<size_t> seq;
+        T value;
+    };
+
+    std::array<Cell, Capacity> _cells;
+    alignas(64) std::atomic<size_t> _enqueue{0};
+    alignas(64) size_t _dequeue{0};
+};
@@ -9,9 +9,17 @@
 class SerialDiagnostics : public IDiagnosticsSink {
 public:
     void handle(const DiagnosticsEvent& ev) override {
-        const char* lvl = ev.level == LogLevel::Info ? "INFO" : "WARN";
         char buf[128];
-        sprintf(buf, "[%lu] %s: %s", platform::toEmbedded(ev.timestamp), lvl, ev.message.c_str());
+        int n = snprintf(buf, sizeof(buf), "[%lu] %s: ",
+                         static_cast<unsigned long>(platform::toEmbedded(ev.timestamp)),
+                         levelName(ev.level));
+        if (const char* text = ev.plainText()) {
+            // Plain text goes out whole rather than through the line buffer
+            if (n > 0 && static_cast<size_t>(n) < sizeof(buf)) Serial.print(buf);
+            Serial.println(text);
+            return;
+        }
+        if (n > 0 && static_cast<size_t>(n) < sizeof(buf)) ev.render(buf + n, sizeof(buf) - n);
         Serial.println(buf);
     }
 };
@@ -3,21 +3,25 @@
 #include <Platform/IPlatform.h>
 #include <Diagnostics/IDiagnostics.h>
 #include <Calibration/CalibrationManager.h>
-#include <deque>
-#include <string>
+#include <Instrumentation/LatencyProbe.h>
 
 struct DiagnosticsViewModel {
     CalibrationManager::CalibrationStatus status;
     platform::TimeMs minutesSinceCalibration;
-    const std::deque<std::string>* history; // may be nullptr
+    const IBufferedDiagnostics* history; // may be nullptr
 };
 
 class DiagnosticsView {
 public:
+    static constexpr size_t kPageSize = 5;
+
     DiagnosticsView(IUserIO& io, IOutput& out, IPlatform& platform);
     char readCharBlocking() const;
     bool confirmClear() const;
+    // Shows the page of kPageSize history records starting at index
     void render(const DiagnosticsViewModel& model, size_t index) const;
+    // Shows loop rate and per-stage latency percentiles
+    void renderLatency(const LatencyProbes& probes, platform::TimeMs now) const;
     IPlatform& platform() const { return _platform; }
 private:
     IUserIO& _io;
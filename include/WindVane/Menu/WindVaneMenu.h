@@ -60,11 +60,13 @@ class WindVaneMenu {
     Help
   };
   std::unordered_map<char, std::function<void()>> _mainHandlers;
+  size_t _calibrationShown{0}; ///< Positions last reported on the status line
 
   void showMainMenu() const;
   void handleMainInput(char c);
 
-  MenuResult runCalibration();
+  MenuResult startCalibration();
+  void updateCalibration();
   void handleDisplaySelection();
   void handleCalibrateSelection();
   void handleDiagnosticsSelection();
@@ -43,12 +43,19 @@ inline TimeMs elapsed(TimeMs start, TimeMs end) { return end - start; }
 
 #ifdef ARDUINO
 inline TimeMs now() { return TimeMs{::millis()}; }
+// Monotonic microseconds; wraps after ~71 minutes
+inline uint32_t nowUs() { return ::micros(); }
 #else
 inline TimeMs now() {
     using namespace std::chrono;
     static auto start = steady_clock::now();
     return TimeMs{static_cast<TimeMs::rep>(duration_cast<milliseconds>(steady_clock::now() - start).count())};
 }
+inline uint32_t nowUs() {
+    using namespace std::chrono;
+    static auto start = steady_clock::now();
+    return static_cast<uint32_t>(duration_cast<microseconds>(steady_clock::now() - start).count());
+}
 #endif
 
 inline uint32_t toEmbedded(TimeMs t) { return t.count(); }
@@ -0,0 +1,110 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <stdint.h>
+#include <Platform/TimeUtils.h>
+
+namespace circular {
+
+constexpr uint16_t kSteps = 1024;          ///< Table resolution per revolution
+constexpr uint16_t kQuarter = kSteps / 4;
+constexpr int32_t kOne = 32767;            ///< 1.0 in Q15
+
+// Taylor series to x^15; accurate to ~1e-9 over [0, pi/2], which is well
+// below Q15 resolution.
+constexpr double sinQuarter(double x) {
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 8; ++n) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr std::array<int16_t, kQuarter + 1> makeQuarterTable() {
+    std::array<int16_t, kQuarter + 1> table{};
+    for (uint16_t i = 0; i <= kQuarter; ++i) {
+        double v = sinQuarter(1.5707963267948966 * i / kQuarter) * kOne;
+        table[i] = static_cast<int16_t>(v + 0.5);
+    }
+    return table;
+}
+
+constexpr std::array<int16_t, kQuarter + 1> kQuarterSine = makeQuarterTable();
+
+// Q15 sine of step * 360 / kSteps degrees
+constexpr int16_t sinStep(uint16_t step) {
+    step &= kSteps - 1;
+    const uint16_t i = step & (kQuarter - 1);
+    switch (step / kQuarter) {
+    case 0: return kQuarterSine[i];
+    case 1: return kQuarterSine[kQuarter - i];
+    case 2: return static_cast<int16_t>(-kQuarterSine[i]);
+    default: return static_cast<int16_t>(-kQuarterSine[kQuarter - i]);
+    }
+}
+
+constexpr int16_t cosStep(uint16_t step) {
+    return sinStep(static_cast<uint16_t>(step + kQuarter));
+}
+
+// Nearest table step for a direction in hundredths of a degree
+constexpr uint16_t stepFromCentidegrees(uint32_t centidegrees) {
+    return static_cast<uint16_t>(((centidegrees % 36000UL) * kSteps + 18000UL) / 36000UL) &
+           (kSteps - 1);
+}
+
+} // namespace circular
+
+struct DirectionStats {
+    float meanDeg{0.0f};           ///< Vector mean direction, [0, 360)
+    float resultantLength{0.0f};   ///< R in [0, 1]; 1 when all samples agree
+    float variance{1.0f};          ///< Circular variance 1 - R
+    uint32_t samples{0};
+    bool valid() const { return samples > 0; }
+};
+
+// Time-windowed circular mean of wind direction. Samples are reduced to
+// Q15 sin/cos from a constexpr table and summed into time buckets; when
+// the window slides the oldest bucket's sums are subtracted, so updates
+// and queries are O(1) and memory is bounded by the bucket count rather
+// than the sample rate. Integer sums keep long windows free of drift.
+// The window covers between (buckets - 1) and buckets bucket widths.
+class DirectionAverager {
+public:
+    static constexpr size_t kMaxBuckets = 60;
+
+    explicit DirectionAverager(platform::TimeMs window = platform::TimeMs{2000},
+                               size_t buckets = 20);
+
+    void add(float degrees, platform::TimeMs now);
+    void addCentidegrees(uint16_t centidegrees, platform::TimeMs now);
+    // Expires buckets that have left the window without adding a sample
+    void advance(platform::TimeMs now);
+    void reset();
+
+    DirectionStats stats() const;
+
+    platform::TimeMs window() const { return platform::TimeMs{static_cast<uint32_t>(_bucketMs * _buckets)}; }
+    size_t buckets() const { return _buckets; }
+
+private:
+    struct Bucket {
+        int64_t sinSum{0};
+        int64_t cosSum{0};
+        uint32_t count{0};
+    };
+
+    std::array<Bucket, kMaxBuckets> _ring{};
+    size_t _buckets;
+    uint32_t _bucketMs;
+    size_t _head{0};
+    platform::TimeMs _bucketStart{};
+    bool _started{false};
+    int64_t _sinTotal{0};
+    int64_t _cosTotal{0};
+    uint32_t _count{0};
+
+    void addStep(uint16_t step, platform::TimeMs now);
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <stdint.h>
+
+// Earliest-deadline-first queue of periodic tasks with microsecond
+// deadlines. A fixed-size binary min-heap keeps popDue() O(log n) without
+// allocating. Deadlines compare wrap-safely, so a free-running 32-bit
+// micros() counter can drive it.
+class DeadlineScheduler {
+public:
+    static constexpr size_t kCapacity = 64;
+
+    bool add(uint8_t id, uint32_t periodUs, uint32_t firstDueUs);
+    void clear() { _size = 0; }
+
+    // Returns the id of the earliest task due at nowUs and reschedules it
+    // one period later, or -1 when nothing is due. A task that has fallen
+    // a whole period behind restarts from nowUs instead of bursting.
+    int popDue(uint32_t nowUs);
+
+    // Earliest pending deadline; only meaningful when !empty()
+    uint32_t nextDeadline() const { return _heap[0].due; }
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    uint32_t overruns() const { return _overruns; }
+
+    static bool before(uint32_t a, uint32_t b) { return static_cast<int32_t>(a - b) < 0; }
+
+private:
+    struct Entry {
+        uint32_t due;
+        uint32_t period;
+        uint8_t id;
+    };
+
+    std::array<Entry, kCapacity> _heap{};
+    size_t _size{0};
+    uint32_t _overruns{0};
+
+    void siftUp(size_t i);
+    void siftDown(size_t i);
+};
@@ -0,0 +1,94 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+#include "DeadlineScheduler.h"
+#include "../WindVane.h"
+
+#if !defined(ARDUINO)
+#include <thread>
+#endif
+
+struct StationVaneConfig {
+  IADC& adc;
+  ICalibrationStorage& storage; ///< This vane's own storage slot
+  uint32_t sampleRateHz{10};
+  CalibrationMethod method{CalibrationMethod::SPINNING};
+  CalibrationConfig config{};
+  FilterConfig filter{};
+  // Fed at sampleRateHz; readings then report its windowed mean
+  DirectionAverager* averager{nullptr};
+};
+
+// Latest sample of one vane; fields are individually atomic, so a reader
+// racing a worker may pair a direction with the previous timestamp.
+struct StationReading {
+  float degrees{0.0f};
+  uint32_t timestampUs{0};
+  uint32_t samples{0};
+};
+
+// Owns several vanes, each with its own calibration and storage, and
+// samples them at per-vane rates from a deadline scheduler. On MCUs the
+// main loop calls poll(); on host start() spreads the vanes round-robin
+// across worker threads, each with a private scheduler so no vane is
+// touched by more than one thread.
+class WindVaneStation {
+ public:
+  static constexpr size_t kMaxVanes = DeadlineScheduler::kCapacity;
+
+  WindVaneStation(IUserIO& io, IDiagnostics& diag);
+  ~WindVaneStation();
+
+  // Returns the new vane's index, or -1 when full or running
+  int addVane(const StationVaneConfig& cfg);
+  size_t size() const { return _slots.size(); }
+  WindVane& vane(size_t index) { return *_slots[index]->vane; }
+
+  // Samples every vane due at nowUs; returns how many were sampled. Vanes
+  // added since the last poll are first due at this nowUs.
+  size_t poll(uint32_t nowUs);
+  // Earliest pending deadline of the polled scheduler; empty when no vane
+  // has been scheduled yet, in which case the caller should poll now
+  std::optional<uint32_t> nextDeadlineUs() const;
+
+#if !defined(ARDUINO)
+  bool start(size_t workers);
+  void stop();
+  bool running() const { return !_workers.empty(); }
+#endif
+
+  StationReading reading(size_t index) const;
+  uint64_t totalSamples() const;
+  uint32_t overruns() const;
+
+ private:
+  struct Slot {
+    std::unique_ptr<WindVane> vane;
+    uint32_t periodUs;
+    std::atomic<float> degrees{0.0f};
+    std::atomic<uint32_t> timestampUs{0};
+    std::atomic<uint32_t> samples{0};
+  };
+
+  IUserIO& _io;
+  IDiagnostics& _diag;
+  std::vector<std::unique_ptr<Slot>> _slots;
+  DeadlineScheduler _scheduler;
+  size_t _scheduled{0}; ///< Slots already added to _scheduler
+
+  void sample(Slot& slot, uint32_t nowUs);
+
+#if !defined(ARDUINO)
+  struct Worker {
+    DeadlineScheduler scheduler;
+    std::thread thread;
+  };
+  std::vector<std::unique_ptr<Worker>> _workers;
+  std::atomic<bool> _stop{false};
+  std::atomic<uint32_t> _workerOverruns{0};
+
+  void runWorker(Worker& worker);
+#endif
+};
@@ -1,10 +1,16 @@
 #pragma once
 #include "ICalibrationStorage.h"
+#include "Crc32.h"
 #include <cstdint>
 #include <vector>
 
+/// Set in the header version when `sequence` orders EEPROM slots. Older
+/// slots leave it clear and are ordered by timestamp, behind any sequenced one.
+constexpr uint16_t kSequenceVersionFlag = 0x4000;
+
 struct CalibrationStorageHeader {
-    uint16_t version;
+    uint16_t version; // schema version, kCrc32cVersionFlag marks CRC-32C
+    uint16_t sequence; // occupies what was padding on 32-bit targets
     uint32_t timestamp;
     uint16_t count;
     uint32_t crc;
@@ -19,6 +25,11 @@ protected:
     int _schemaVersion{0};
     uint32_t _lastTimestamp{0};
 
-    static uint32_t crc32(const unsigned char* data, size_t len);
-    static uint32_t crc32(const std::vector<ClusterData>& clusters);
+    static uint16_t calibrationSchema(uint16_t stored) {
+        return static_cast<uint16_t>(schemaVersion(stored) & ~kSequenceVersionFlag);
+    }
+    static uint32_t crc32(const unsigned char* data, size_t len,
+                          CrcKind kind = kStorageCrcKind);
+    static uint32_t crc32(const std::vector<ClusterData>& clusters,
+                          CrcKind kind = kStorageCrcKind);
 };
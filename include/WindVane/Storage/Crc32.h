@@ -0,0 +1,59 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Slice-by-8 lookup tables cost 8 KB per polynomial; AVR keeps the
+// bitwise loop so they do not land in SRAM.
+#ifndef WINDVANE_CRC_TABLES
+#if defined(__AVR__)
+#define WINDVANE_CRC_TABLES 0
+#else
+#define WINDVANE_CRC_TABLES 1
+#endif
+#endif
+
+enum class CrcKind : uint8_t {
+    Ieee,       ///< CRC-32 (0xEDB88320), used by pre-flag storage files
+    Castagnoli  ///< CRC-32C (0x82F63B78), hardware accelerated on host
+};
+
+/// Set in a storage header's version field when the payload CRC is CRC-32C.
+/// Headers without it were written with CRC-32 and still validate.
+constexpr uint16_t kCrc32cVersionFlag = 0x8000;
+
+/// Checksum written by current firmware
+constexpr CrcKind kStorageCrcKind = CrcKind::Castagnoli;
+
+constexpr uint16_t storedVersion(uint16_t schema) {
+    return static_cast<uint16_t>(schema | kCrc32cVersionFlag);
+}
+
+constexpr CrcKind crcKindForVersion(uint16_t version) {
+    return (version & kCrc32cVersionFlag) ? CrcKind::Castagnoli : CrcKind::Ieee;
+}
+
+constexpr uint16_t schemaVersion(uint16_t version) {
+    return static_cast<uint16_t>(version & ~kCrc32cVersionFlag);
+}
+
+/// Incremental CRC so checksums can be folded in while bytes are written.
+class Crc32 {
+public:
+    explicit Crc32(CrcKind kind = CrcKind::Castagnoli) : _kind(kind) {}
+
+    void update(const void* data, size_t len);
+    uint32_t value() const { return _state ^ 0xFFFFFFFFu; }
+    void reset() { _state = 0xFFFFFFFFu; }
+    CrcKind kind() const { return _kind; }
+
+    static uint32_t compute(CrcKind kind, const void* data, size_t len);
+    /// True when CRC-32C uses SSE4.2 or ARMv8 CRC instructions
+    static bool hardwareAccelerated();
+    /// Portable path on the raw (pre-inverted) state, exposed for cross-checks
+    static uint32_t updatePortable(CrcKind kind, uint32_t state,
+                                   const unsigned char* data, size_t len);
+
+private:
+    CrcKind _kind;
+    uint32_t _state{0xFFFFFFFFu};
+};
@@ -5,12 +5,19 @@
 #include <Platform/TimeUtils.h>
 #include <Platform/IPlatform.h>
 #include <cstdint>
+#include <vector>
 
 class EEPROMCalibrationStorage final : public CalibrationStorageBase, public IBlobStorage {
 public:
+    static constexpr uint16_t kMaxClusters = 64;
+
+    // regionSize 0 runs to the end of EEPROM; slotCount 0 fits as many
+    // slots of kMaxClusters as the region holds, at least one.
     EEPROMCalibrationStorage(IPlatform& platform,
                              size_t startAddress = 0,
-                             size_t eepromSize = 512);
+                             size_t eepromSize = 512,
+                             size_t regionSize = 0,
+                             int slotCount = 0);
     StorageResult save(const std::vector<ClusterData>& clusters, int version) override;
     StorageResult load(std::vector<ClusterData>& clusters, int &version) override;
     StorageResult clear() override;
@@ -18,13 +25,36 @@ public:
     StorageResult writeBlob(const std::vector<unsigned char>& data) override;
     StorageResult readBlob(std::vector<unsigned char>& data) override;
 
+    int slotCount() const { return _slotCount; }
+    size_t slotSize() const { return _slotSize; }
+    // Largest calibration one slot holds
+    size_t maxClusters() const;
+    // Non-Ok when the region does not fit the EEPROM or a slot is too
+    // small for a single cluster; save and load return it unchanged
+    const StorageResult& layout() const { return _layout; }
+
 private:
+    // RAM copy of each slot header, read once and kept current by save()
+    struct SlotEntry {
+        bool valid;
+        bool sequenced;
+        uint16_t sequence;
+        uint32_t timestamp;
+    };
+
     size_t _startAddress;
     size_t _eepromSize;
+    size_t _regionSize;
     int _slotCount;
     size_t _slotSize;
+    StorageResult _layout;
     IPlatform& _platform;
+    std::vector<SlotEntry> _slots;
+    bool _directoryLoaded{false};
+    uint16_t _nextSequence{0};
 
-    int findLatestSlot() const;
+    void loadDirectory();
+    int findLatestSlot();
+    static bool newer(const SlotEntry& a, const SlotEntry& b);
     size_t slotAddr(int slot) const { return _startAddress + slot * _slotSize; }
 };
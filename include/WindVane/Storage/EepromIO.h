@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <stdint.h>
+
+class EmulatedEeprom;
+
+// Block EEPROM access shared by the EEPROM storage classes. Arduino builds
+// use the EEPROM library; host builds use an EmulatedEeprom when one is
+// installed and report no EEPROM otherwise.
+namespace platform_factory {
+
+// Counters for the block EEPROM layer. bytesRequested is what callers
+// asked to write; bytesWritten is what actually differed and was stored.
+struct EepromStats {
+    uint32_t reads{0};
+    uint32_t bytesRead{0};
+    uint32_t writes{0};
+    uint32_t bytesRequested{0};
+    uint32_t bytesWritten{0};
+    uint32_t commits{0};
+    uint32_t commitsSkipped{0}; ///< Commits dropped because nothing changed
+};
+
+void eeprom_begin(size_t size);
+void eeprom_commit();
+void eeprom_end();
+void eeprom_write_bytes(size_t addr, const void* data, size_t len);
+void eeprom_read_bytes(size_t addr, void* data, size_t len);
+uint8_t eeprom_read_byte(size_t addr);
+void eeprom_write_byte(size_t addr, uint8_t value);
+bool has_eeprom();
+EepromStats eeprom_stats();
+void eeprom_reset_stats();
+
+#ifndef ARDUINO
+// Routes the EEPROM functions to `eeprom` (nullptr detaches); it must
+// outlive its use. Host only.
+void use_emulated_eeprom(EmulatedEeprom* eeprom);
+#endif
+
+} // namespace platform_factory
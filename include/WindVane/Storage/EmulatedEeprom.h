@@ -0,0 +1,45 @@
+#pragma once
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// Host stand-in for the ESP32 EEPROM library, backed by a memory-mapped
+// file so contents survive a simulated reboot. begin() loads a RAM cache,
+// writes only touch the cache, and commit() erases every flash sector the
+// cache spans before programming it back, as the ESP32 core does. Changes
+// not committed when the object dies are lost, like a power cut.
+class EmulatedEeprom {
+public:
+    static constexpr size_t kSectorSize = 4096;
+
+    explicit EmulatedEeprom(const std::string& path, size_t capacity = kSectorSize);
+    ~EmulatedEeprom();
+    EmulatedEeprom(const EmulatedEeprom&) = delete;
+    EmulatedEeprom& operator=(const EmulatedEeprom&) = delete;
+
+    bool ok() const { return _flash != nullptr; }
+    size_t capacity() const { return _capacity; }
+
+    bool begin(size_t size);
+    void read(size_t addr, void* data, size_t len) const;
+    void write(size_t addr, const void* data, size_t len);
+    bool commit();
+    // Commits pending changes and releases the cache, like EEPROM.end()
+    void end();
+
+    uint32_t commits() const { return _commits; }
+    uint32_t erases() const { return _erases; }
+    uint32_t sectorErases(size_t sector) const;
+    void resetCounters();
+
+private:
+    std::string _path;
+    size_t _capacity;
+    uint8_t* _flash{nullptr};
+    std::vector<uint8_t> _cache;
+    bool _dirty{false};
+    uint32_t _commits{0};
+    uint32_t _erases{0};
+    std::vector<uint32_t> _sectorErases;
+};
@@ -0,0 +1,65 @@
+#pragma once
+#include "SettingsStorageBase.h"
+#include "SettingsData.h"
+#include <cstddef>
+#include <stdint.h>
+
+// Log-structured settings store. Each save appends one 8-byte record per
+// changed field instead of rewriting the whole block, so a menu navigation
+// costs a single record. The region is split into two halves; when the
+// active half fills, a full snapshot is written to the other half and
+// appending continues there. Boot recovers the latest value of every field
+// with one linear scan.
+class JournalSettingsStorage final : public SettingsStorageBase {
+public:
+    enum class Field : uint8_t {
+        SpinThreshold = 1,
+        SpinBufferSize,
+        SpinExpectedPositions,
+        SpinSampleDelayMs,
+        SpinStallTimeoutSec,
+        MenuState,
+        Count
+    };
+    static constexpr size_t kFieldCount = static_cast<size_t>(Field::Count) - 1;
+
+    struct Record {
+        uint8_t field;
+        uint8_t check; // CRC-8 of the other bytes; rejects erased and torn slots
+        uint16_t seq;
+        uint32_t value;
+    };
+    static_assert(sizeof(Record) == 8, "journal records must stay 8 bytes");
+
+    // regionSize 0 runs the journal to the end of EEPROM
+    explicit JournalSettingsStorage(size_t startAddress = 256, size_t eepromSize = 512,
+                                    size_t regionSize = 0);
+    StorageResult save(const SettingsData& data) override;
+    StorageResult load(SettingsData& data) override;
+
+    size_t recordCapacity() const { return _halfRecords * 2; }
+    uint32_t compactions() const { return _compactions; }
+
+    static uint8_t checkByte(const Record& r);
+
+private:
+    size_t _start;
+    size_t _size;
+    size_t _halfRecords;
+    size_t _head{0};        // next slot to write
+    uint16_t _nextSeq{0};
+    bool _scanned{false};
+    bool _haveState{false}; // _current mirrors what the journal holds
+    uint32_t _compactions{0};
+    SettingsData _current{};
+
+    StorageResult scan();
+    size_t slotAddr(size_t slot) const { return _start + slot * sizeof(Record); }
+    size_t halfEnd(size_t slot) const { return slot < _halfRecords ? _halfRecords : _halfRecords * 2; }
+    void writeRecord(Field field, uint32_t value);
+    size_t diff(const SettingsData& data, Field* changed) const;
+    size_t writeSnapshot(const SettingsData& data);
+
+    static uint32_t encode(const SettingsData& data, Field field);
+    static void decode(SettingsData& data, Field field, uint32_t value);
+};
@@ -3,16 +3,38 @@
 #include "ISettingsStorage.h"
 #include "../StorageResult.h"
 #include <Diagnostics/IDiagnostics.h>
+#include <Platform/TimeUtils.h>
 #include <WindVane.h>
 
-/** Manages loading, applying and saving device settings. */
+/** Manages loading, applying and saving device settings.
+ *
+ * Setters only mark the data dirty. The write is deferred until the
+ * changes have been idle for the flush delay (see poll()), an explicit
+ * save() or flush(), or destruction, so a burst of changes costs one
+ * physical write. */
 class SettingsManager {
 public:
+    static constexpr platform::TimeMs kDefaultFlushDelay{2000};
+
     SettingsManager(ISettingsStorage& storage, IDiagnostics& diag);
+    ~SettingsManager();
+    SettingsManager(const SettingsManager&) = delete;
+    SettingsManager& operator=(const SettingsManager&) = delete;
 
     StorageResult load();
     void apply(WindVane& vane) const;
-    StorageResult save() const;
+    /// Writes the current settings now, dirty or not
+    StorageResult save();
+    /// Writes pending changes now; a no-op when nothing changed
+    StorageResult flush();
+    /// Writes pending changes once they have been idle for the flush delay.
+    /// Call from the main loop.
+    StorageResult poll(platform::TimeMs now);
+    void setFlushDelay(platform::TimeMs delay) { _flushDelay = delay; }
+
+    bool dirty() const { return _revision != _savedRevision; }
+    /// Outcome of the most recent physical write
+    const StorageResult& lastFlush() const { return _lastFlush; }
 
     const SettingsData& getData() const { return _data; }
 
@@ -34,8 +56,17 @@ public:
 
 private:
     void ensureValid();
+    void markDirty() { ++_revision; }
 
     ISettingsStorage& _storage;
     SettingsData _data;
     IDiagnostics& _diag;
+    platform::TimeMs _flushDelay{kDefaultFlushDelay};
+    // Idle time is measured from the first poll() that sees a revision, so
+    // setters need no clock.
+    uint32_t _revision{0};
+    uint32_t _savedRevision{0};
+    uint32_t _polledRevision{0};
+    platform::TimeMs _changedAt{0};
+    StorageResult _lastFlush{};
 };
@@ -1,9 +1,10 @@
 #pragma once
 #include "ISettingsStorage.h"
+#include "Crc32.h"
 #include <cstdint>
 
 struct SettingsStorageHeader {
-    uint16_t version;
+    uint16_t version; // kCrc32cVersionFlag marks CRC-32C
     uint32_t crc;
 };
 
@@ -12,5 +13,7 @@ public:
     int getSchemaVersion() const override { return _schemaVersion; }
 protected:
     int _schemaVersion{0};
-    static uint32_t crc32(const unsigned char* data, size_t len);
+    static constexpr uint16_t kSettingsVersion = 1;
+    static uint32_t crc32(const unsigned char* data, size_t len,
+                          CrcKind kind = kStorageCrcKind);
 };
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "../Storage/StorageResult.h"
+
+// Binary trace of raw ADC samples. Layout, little-endian:
+//   header: "WVTR" magic, uint16 version, uint16 record size
+//   records: uint32 timestamp (ms), uint16 12-bit code
+// Records are packed at six bytes so field sessions stay small.
+
+struct TraceRecord {
+    uint32_t timestampMs;
+    uint16_t code;
+};
+
+namespace trace_format {
+constexpr char kMagic[4] = {'W', 'V', 'T', 'R'};
+constexpr uint16_t kVersion = 1;
+constexpr size_t kHeaderSize = 8;
+constexpr size_t kRecordSize = 6;
+} // namespace trace_format
+
+// Appends records to a trace file. Writes go through the stream buffer, so
+// append() is cheap enough to call from the sampling path.
+class TraceWriter {
+public:
+    explicit TraceWriter(const std::string& path);
+    ~TraceWriter();
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    void append(const TraceRecord& rec);
+    StorageResult close();
+    StorageResult status() const;
+    size_t count() const { return _count; }
+
+private:
+    std::ofstream _out;
+    size_t _count{0};
+};
+
+// Read-only view of a trace file. Memory-mapped on POSIX hosts; elsewhere
+// the file is read into memory once.
+class MappedTrace {
+public:
+    MappedTrace() = default;
+    ~MappedTrace();
+    MappedTrace(const MappedTrace&) = delete;
+    MappedTrace& operator=(const MappedTrace&) = delete;
+
+    StorageResult open(const std::string& path);
+    void close();
+
+    size_t size() const { return _count; }
+    bool empty() const { return _count == 0; }
+    TraceRecord operator[](size_t index) const;
+
+private:
+    const unsigned char* _data{nullptr};
+    size_t _length{0};
+    size_t _count{0};
+    bool _mapped{false};
+    std::vector<unsigned char> _fallback;
+};
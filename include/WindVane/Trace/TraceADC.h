@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <Platform/TimeUtils.h>
+#include "../IADC.h"
+#include "SampleTrace.h"
+
+// Passes reads through to another ADC and records each sample, with the
+// time it was taken, to a trace.
+class RecordingADC : public IADC {
+public:
+    using Clock = platform::TimeMs (*)();
+
+    RecordingADC(IADC& source, TraceWriter& writer, Clock clock = &platform::now)
+        : _source(source), _writer(writer), _clock(clock) {}
+
+    float read() const override { return readCode() / 4095.0f; }
+    uint16_t readCode() const override;
+
+private:
+    IADC& _source;
+    TraceWriter& _writer;
+    Clock _clock;
+};
+
+// Serves samples from a recorded trace. Each read returns the record at the
+// cursor and advances it; after the last record the final code repeats.
+class ReplayADC : public IADC {
+public:
+    explicit ReplayADC(const MappedTrace& trace) : _trace(trace) {}
+
+    float read() const override { return readCode() / 4095.0f; }
+    uint16_t readCode() const override;
+
+    void seek(size_t index) { _cursor = index; }
+    size_t cursor() const { return _cursor; }
+    bool exhausted() const { return _cursor >= _trace.size(); }
+
+private:
+    const MappedTrace& _trace;
+    mutable size_t _cursor{0};
+};
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "../Calibration/CalibrationSession.h"
+#include "../Calibration/ClusterData.h"
+#include "../Calibration/SpinningConfig.h"
+#include "SampleTrace.h"
+
+struct ReplayResult {
+    CalibrationProgress progress{};
+    std::vector<ClusterData> clusters{}; ///< What the session would have saved
+    size_t samples{0};                   ///< Records consumed before the session ended
+};
+
+// Runs recorded traces through SpinningMethod offline. Time comes from the
+// trace timestamps, so sample pacing and stall timeouts cost no wall-clock
+// time and a session replays as fast as the CPU can process it.
+class TraceReplay {
+public:
+    explicit TraceReplay(const MappedTrace& trace) : _trace(trace) {}
+
+    ReplayResult run(const SpinningConfig& config) const;
+
+private:
+    const MappedTrace& _trace;
+};
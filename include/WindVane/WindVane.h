@@ -8,6 +8,8 @@
 #include "Calibration/CalibrationResult.h"
 #include "Calibration/CalibrationMethod.h"
 #include "Calibration/CalibrationConfig.h"
+#include "Acquisition/FilteredADC.h"
+#include "Processing/DirectionAverager.h"
 #include "Diagnostics/IDiagnostics.h"
 #include "IADC.h"
 #include "UI/IIO.h"
@@ -33,6 +35,11 @@ struct WindVaneConfig {
   IUserIO& io;
   IDiagnostics& diag;
   CalibrationConfig config{};
+  // Oversampling stage in front of the direction mapping; calibration
+  // still sees raw samples so detent transitions are not smeared
+  FilterConfig filter{};
+  // When set, sample() feeds it and getDirection returns its circular mean
+  DirectionAverager* averager{nullptr};
 };
 
 class WindVane {
@@ -40,9 +47,27 @@ class WindVane {
   // All dependencies must be provided via the configuration structure
   explicit WindVane(const WindVaneConfig &cfg);
 
+  // Reads the vane once and feeds any attached averager; call at the
+  // acquisition rate. Returns what getDirection would now report.
+  float sample(platform::TimeMs now);
+  // Windowed mean when an averager holds samples, else the instant
+  // direction. Never adds to the window, so UI reads do not skew it.
   float getDirection() const;
+  // Unsmoothed direction, regardless of any attached averager
+  float getInstantDirection() const;
+  // Mean and circular variance of the attached averager's window
+  DirectionStats getDirectionStats() const;
+  void setAverager(DirectionAverager* averager) { _averager = averager; }
+  // FPU-free variant of getDirection, in hundredths of a degree (0-35999)
+  uint16_t getDirectionCentidegrees() const;
   CalibrationResult calibrate();       // New: simple method alias for runCalibration()
   CalibrationResult runCalibration();  // Advanced
+  // Non-blocking calibration driven from the main loop; see CalibrationManager
+  CalibrationResult startCalibration(platform::TimeMs now);
+  bool stepCalibration(platform::TimeMs now);
+  void abortCalibration();
+  void finishCalibration();
+  CalibrationProgress getCalibrationProgress() const;
   platform::TimeMs getLastCalibrationTimestamp() const;
   CalibrationManager::CalibrationStatus getCalibrationStatus() const;
   StorageResult clearCalibration() const;
@@ -52,7 +77,10 @@ class WindVane {
 
  private:
   float getRawDirection() const;
+  const IADC& directionInput() const;
   IADC& _adc;
+  std::unique_ptr<FilteredADC> _filtered;
+  DirectionAverager* _averager;
   WindVaneType _type;
   std::unique_ptr<CalibrationManager> _calibrationManager;
   ICalibrationStorage* _storage;
@@ -1,14 +1,31 @@
 #pragma once
 #include <string>
+#include <stdint.h>
 
 /** Configuration parameters for the hardware setup. */
 struct DeviceConfig {
   int windVanePin = 34;              ///< GPIO connected to the wind vane
   unsigned long serialBaud = 115200; ///< Baud rate for the serial console
   size_t calibrationAddress = 0;     ///< EEPROM start for calibration data
-  size_t settingsAddress = 256;      ///< EEPROM start for settings data
-  size_t eepromSize = 512;           ///< Size passed to EEPROM.begin
+  int calibrationSlots = 0;          ///< Rotating calibration slots, 0 to fit the region
+  size_t settingsAddress = 3072;     ///< EEPROM start for settings; ends calibration
+  size_t settingsSize = 1024;        ///< EEPROM bytes reserved for settings
+  size_t eepromSize = 4096;          ///< Size passed to EEPROM.begin, one flash sector
+  uint32_t sampleRateHz = 1000;      ///< Background acquisition rate
   std::string settingsFile = "settings.cfg"; ///< Path for file based settings
 };
 
 inline DeviceConfig defaultDeviceConfig() { return DeviceConfig{}; }
+
+/** Calibration runs from its start address up to the settings region. */
+inline size_t calibrationRegionSize(const DeviceConfig& cfg) {
+  return cfg.settingsAddress > cfg.calibrationAddress
+             ? cfg.settingsAddress - cfg.calibrationAddress
+             : 0;
+}
+
+/** True when both regions are non-empty, disjoint and inside the EEPROM. */
+inline bool eepromLayoutValid(const DeviceConfig& cfg) {
+  return calibrationRegionSize(cfg) > 0 && cfg.settingsSize > 0 &&
+         cfg.settingsAddress + cfg.settingsSize <= cfg.eepromSize;
+}
@@ -1,19 +1,22 @@
 #include "PlatformFactory.h"
 #ifdef ARDUINO
 #include <Drivers/ESP32/ADC.h>
+#include <Acquisition/ESP32ContinuousAcquisition.h>
 #include <Storage/EEPROMCalibrationStorage.h>
-#include <Storage/Settings/EEPROMSettingsStorage.h>
+#include <Storage/Settings/JournalSettingsStorage.h>
 #include <UI/SerialIOHandler.h>
 #include <UI/SerialOutput.h>
 #include <Arduino.h>
 #else
-#include "host/NullADC.h"
+#include <Drivers/SimulatedVaneADC.h>
+#include <Acquisition/ThreadedAcquisition.h>
 #include <Storage/FileCalibrationStorage.h>
 #include <Storage/Settings/FileSettingsStorage.h>
 #include <UI/ConsoleIOHandler.h>
 #include <UI/ConsoleOutput.h>
 #include <chrono>
 #endif
+#include <cassert>
 #include <cstring>
 #include <WindVaneMenu/MenuPresenter.h>
 
@@ -103,85 +106,41 @@ std::unique_ptr<IADC> makeADC(const DeviceConfig& cfg) {
 #ifdef ARDUINO
     return std::make_unique<ESP32ADC>(cfg.windVanePin);
 #else
-    return std::make_unique<NullADC>();
+    (void)cfg;
+    // Slow continuous rotation so live display and calibration have
+    // something to show without hardware
+    auto adc = std::make_unique<SimulatedVaneADC>();
+    adc->setScript(RotationScript{}.spin(0.0f, 1.0f, 4000).loop());
+    return adc;
 #endif
 }
 
-std::unique_ptr<ICalibrationStorage> makeCalibrationStorage(IPlatform& platform, const DeviceConfig& cfg) {
+std::unique_ptr<IAcquisition> makeAcquisition(IADC& adc, const DeviceConfig& cfg) {
 #ifdef ARDUINO
-    return std::make_unique<EEPROMCalibrationStorage>(platform, cfg.calibrationAddress, cfg.eepromSize);
+    (void)adc;
+    return std::make_unique<ESP32ContinuousAcquisition>(cfg.windVanePin, cfg.sampleRateHz);
 #else
-    return std::make_unique<FileCalibrationStorage>("calib.dat");
+    return std::make_unique<ThreadedAcquisition>(adc, cfg.sampleRateHz);
 #endif
 }
 
-std::unique_ptr<ISettingsStorage> makeSettingsStorage(const DeviceConfig& cfg) {
-#ifdef ARDUINO
-    return std::make_unique<EEPROMSettingsStorage>(cfg.settingsAddress, cfg.eepromSize);
-#else
-    return std::make_unique<FileSettingsStorage>(cfg.settingsFile);
-#endif
-}
-
-void eeprom_begin(size_t size) {
-#ifdef ARDUINO
-    EEPROM.begin(size);
-#else
-    (void)size;
-#endif
-}
-
-void eeprom_commit() {
-#ifdef ARDUINO
-    EEPROM.commit();
-#endif
-}
-
-void eeprom_end() {
-#ifdef ARDUINO
-    EEPROM.end();
-#endif
-}
-
-void eeprom_write_bytes(size_t addr, const void* data, size_t len) {
-#ifdef ARDUINO
-    const uint8_t* p = static_cast<const uint8_t*>(data);
-    for (size_t i = 0; i < len; ++i) EEPROM.write(addr + i, p[i]);
-#else
-    (void)addr; (void)data; (void)len;
-#endif
-}
-
-void eeprom_read_bytes(size_t addr, void* data, size_t len) {
-#ifdef ARDUINO
-    uint8_t* p = static_cast<uint8_t*>(data);
-    for (size_t i = 0; i < len; ++i) p[i] = EEPROM.read(addr + i);
-#else
-    (void)addr; (void)data; (void)len;
-#endif
-}
-
-uint8_t eeprom_read_byte(size_t addr) {
-#ifdef ARDUINO
-    return EEPROM.read(addr);
-#else
-    (void)addr; return 0;
-#endif
-}
-
-void eeprom_write_byte(size_t addr, uint8_t value) {
+std::unique_ptr<ICalibrationStorage> makeCalibrationStorage(IPlatform& platform, const DeviceConfig& cfg) {
 #ifdef ARDUINO
-    EEPROM.write(addr, value);
+    assert(eepromLayoutValid(cfg) && "calibration and settings EEPROM regions overlap");
+    return std::make_unique<EEPROMCalibrationStorage>(platform, cfg.calibrationAddress, cfg.eepromSize,
+                                                      calibrationRegionSize(cfg), cfg.calibrationSlots);
 #else
-    (void)addr; (void)value;
+    return std::make_unique<FileCalibrationStorage>("calib.dat");
 #endif
 }
 
-bool has_eeprom() {
+std::unique_ptr<ISettingsStorage> makeSettingsStorage(const DeviceConfig& cfg) {
 #ifdef ARDUINO
-    return true;
+    assert(eepromLayoutValid(cfg) && "calibration and settings EEPROM regions overlap");
+    return std::make_unique<JournalSettingsStorage>(cfg.settingsAddress, cfg.eepromSize,
+                                                    cfg.settingsSize);
 #else
-    return false;
+    return std::make_unique<FileSettingsStorage>(cfg.settingsFile);
 #endif
 }
 
@@ -0,0 +1,106 @@
+#include "DecimationFilter.h"
+#include <algorithm>
+
+namespace {
+
+unsigned log2Ceil(uint32_t v) {
+    unsigned bits = 0;
+    while ((1UL << bits) < v) ++bits;
+    return bits;
+}
+
+} // namespace
+
+DecimationFilter::DecimationFilter(const FilterConfig& cfg) : _cfg(cfg) {
+    if (_cfg.type == FilterType::None) _cfg.decimation = 1;
+    _cfg.decimation = std::clamp<uint16_t>(_cfg.decimation, 1, kMaxWindow);
+    _cfg.window = std::clamp<uint16_t>(_cfg.window, 1, kMaxWindow);
+    _cfg.order = std::clamp<uint8_t>(_cfg.order, 1, kMaxOrder);
+
+    switch (_cfg.type) {
+    case FilterType::None:
+        _gain = 1;
+        break;
+    case FilterType::MovingAverage:
+        _gain = _cfg.window;
+        break;
+    case FilterType::CIC: {
+        // Drop stages until the register growth fits in 32 bits
+        const unsigned bitsPerStage = log2Ceil(_cfg.decimation);
+        while (_cfg.order > 1 && _cfg.order * bitsPerStage > kCicGrowthBits) --_cfg.order;
+        _gain = 1;
+        for (uint8_t i = 0; i < _cfg.order; ++i) _gain *= _cfg.decimation;
+        break;
+    }
+    }
+    _scale = 1.0f / (static_cast<float>(_gain) * 4095.0f);
+}
+
+void DecimationFilter::reset() {
+    _output = 0;
+    _phase = 0;
+    _pushed = 0;
+    _window.fill(0);
+    _sum = 0;
+    _head = 0;
+    _integrators.fill(0);
+    _combDelay.fill(0);
+}
+
+bool DecimationFilter::settled() const {
+    switch (_cfg.type) {
+    case FilterType::MovingAverage:
+        return _pushed >= _cfg.window;
+    case FilterType::CIC:
+        return _pushed >= static_cast<uint32_t>(_cfg.order) * _cfg.decimation;
+    default:
+        return _pushed > 0;
+    }
+}
+
+uint16_t DecimationFilter::outputCode() const {
+    return static_cast<uint16_t>((_output + _gain / 2) / _gain);
+}
+
+bool DecimationFilter::push(uint16_t code) {
+    if (_pushed < 0xFFFFFFFFu) ++_pushed;
+    switch (_cfg.type) {
+    case FilterType::None:
+        _output = code;
+        return true;
+
+    case FilterType::MovingAverage:
+        _sum += code;
+        _sum -= _window[_head];
+        _window[_head] = code;
+        if (++_head == _cfg.window) _head = 0;
+        if (++_phase < _cfg.decimation) return false;
+        _phase = 0;
+        // Until the window fills, scale the partial sum up to full gain
+        _output = _pushed >= _cfg.window ? _sum : _sum * _cfg.window / _pushed;
+        return true;
+
+    case FilterType::CIC: {
+        uint32_t acc = code;
+        for (uint8_t i = 0; i < _cfg.order; ++i) acc = _integrators[i] += acc;
+        if (++_phase < _cfg.decimation) return false;
+        _phase = 0;
+        for (uint8_t i = 0; i < _cfg.order; ++i) {
+            uint32_t in = acc;
+            acc -= _combDelay[i];
+            _combDelay[i] = in;
+        }
+        _output = acc;
+        return true;
+    }
+    }
+    return false;
+}
+
+size_t DecimationFilter::process(const uint16_t* codes, size_t count, float* out) {
+    size_t written = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (push(codes[i])) out[written++] = outputFraction();
+    }
+    return written;
+}
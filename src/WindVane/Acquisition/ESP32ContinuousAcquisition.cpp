@@ -0,0 +1,103 @@
+#include "ESP32ContinuousAcquisition.h"
+#if defined(ARDUINO_ARCH_ESP32)
+#include <Arduino.h>
+#include <freertos/semphr.h>
+
+namespace {
+// The continuous driver's frame callback carries no context
+ESP32ContinuousAcquisition* gActive = nullptr;
+TaskHandle_t gTask = nullptr;
+// Lowest conversion rate the ESP32 continuous driver accepts
+constexpr uint32_t kMinConversionHz = 20000;
+} // namespace
+
+ESP32ContinuousAcquisition::ESP32ContinuousAcquisition(int pin, uint32_t rateHz)
+    : AcquisitionBase(rateHz), _pin(static_cast<uint8_t>(pin)) {}
+
+ESP32ContinuousAcquisition::~ESP32ContinuousAcquisition() { stop(); }
+
+bool ESP32ContinuousAcquisition::start() {
+    if (running()) return true;
+    if (gActive) return false;
+    // Average enough conversions per sample to stay above the driver minimum
+    uint32_t perSample = (kMinConversionHz + _rateHz - 1) / _rateHz;
+    if (perSample == 0) perSample = 1;
+    const uint8_t pins[] = {_pin};
+    if (!analogContinuous(pins, 1, perSample, _rateHz * perSample, &onFrame))
+        return false;
+    _exited = xSemaphoreCreateBinary();
+    if (!_exited) {
+        analogContinuousDeinit();
+        return false;
+    }
+    _stop = false;
+    gActive = this;
+    if (xTaskCreate(&taskEntry, "wv_adc", 2048, this, configMAX_PRIORITIES - 2,
+                    &gTask) != pdPASS) {
+        release();
+        return false;
+    }
+    _task = gTask;
+    _startUs = static_cast<uint32_t>(micros());
+    if (!analogContinuousStart()) {
+        stopTask();
+        release();
+        return false;
+    }
+    return true;
+}
+
+void ESP32ContinuousAcquisition::stop() {
+    if (!running()) return;
+    analogContinuousStop();
+    stopTask();
+    release();
+}
+
+// Asks the task to leave its loop and waits until it has. The task then
+// blocks forever, so deleting it here never races a self-delete.
+void ESP32ContinuousAcquisition::stopTask() {
+    _stop = true;
+    xTaskNotifyGive(static_cast<TaskHandle_t>(_task));
+    xSemaphoreTake(static_cast<SemaphoreHandle_t>(_exited), portMAX_DELAY);
+    gTask = nullptr; // frame callbacks must not notify a deleted task
+    vTaskDelete(static_cast<TaskHandle_t>(_task));
+    _task = nullptr;
+}
+
+void ESP32ContinuousAcquisition::release() {
+    analogContinuousDeinit();
+    if (_exited) vSemaphoreDelete(static_cast<SemaphoreHandle_t>(_exited));
+    _exited = nullptr;
+    _task = nullptr;
+    gTask = nullptr;
+    gActive = nullptr;
+}
+
+void ARDUINO_ISR_ATTR ESP32ContinuousAcquisition::onFrame() {
+    BaseType_t woken = pdFALSE;
+    if (gTask) vTaskNotifyGiveFromISR(gTask, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+void ESP32ContinuousAcquisition::taskEntry(void* self) {
+    auto* acq = static_cast<ESP32ContinuousAcquisition*>(self);
+    while (!acq->_stop) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        acq->drainFrames();
+    }
+    xSemaphoreGive(static_cast<SemaphoreHandle_t>(acq->_exited));
+    vTaskSuspend(nullptr);
+}
+
+void ESP32ContinuousAcquisition::drainFrames() {
+    adc_continuous_data_t* result = nullptr;
+    while (analogContinuousRead(&result, 0)) {
+        int raw = result[0].avg_read_raw;
+        if (raw < 0) raw = 0;
+        if (raw > 4095) raw = 4095;
+        const uint32_t t = static_cast<uint32_t>(micros()) - _startUs;
+        _ring.push({t, static_cast<uint16_t>(raw)});
+    }
+}
+#endif
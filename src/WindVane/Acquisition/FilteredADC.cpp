@@ -0,0 +1,19 @@
+#include "FilteredADC.h"
+
+void FilteredADC::pull() const {
+    // The first read also flushes the filter's startup transient
+    do {
+        while (!_filter.push(_source.readCode())) {
+        }
+    } while (!_filter.settled());
+}
+
+float FilteredADC::read() const {
+    pull();
+    return _filter.outputFraction();
+}
+
+uint16_t FilteredADC::readCode() const {
+    pull();
+    return _filter.outputCode();
+}
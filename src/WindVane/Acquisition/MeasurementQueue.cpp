@@ -0,0 +1,68 @@
+#include "MeasurementQueue.h"
+#include <cmath>
+
+#if !defined(ARDUINO)
+#include <chrono>
+#endif
+
+namespace WindVane {
+
+bool MeasurementPublisher::addConsumer(MeasurementQueue& queue) {
+    if (_queueCount == kMaxConsumers) return false;
+    _queues[_queueCount++] = &queue;
+    return true;
+}
+
+void MeasurementPublisher::sample(TimeMs now) {
+    float degrees = 0.0f;
+    DirectionMeasurement m;
+    m.timestamp = now;
+    if (_read(_context, degrees)) {
+        float wrapped = std::fmod(degrees, 360.0f);
+        if (wrapped < 0.0f) wrapped += 360.0f;
+        // fmod of a value just below a multiple of 360 can round up to it
+        m.degrees = wrapped < 360.0f ? wrapped : 0.0f;
+        m.isValid = true;
+    }
+    for (size_t i = 0; i < _queueCount; ++i) _queues[i]->push(m);
+    _published.fetch_add(1, std::memory_order_relaxed);
+}
+
+#if !defined(ARDUINO)
+
+ThreadedMeasurementSampler::ThreadedMeasurementSampler(ReadFn read, void* context,
+                                                       uint32_t rateHz)
+    : MeasurementPublisher(read, context), _rateHz(rateHz ? rateHz : 1) {}
+
+ThreadedMeasurementSampler::~ThreadedMeasurementSampler() { stop(); }
+
+bool ThreadedMeasurementSampler::start() {
+    if (running()) return true;
+    _stop.store(false);
+    _thread = std::thread(&ThreadedMeasurementSampler::run, this);
+    return true;
+}
+
+void ThreadedMeasurementSampler::stop() {
+    if (!running()) return;
+    _stop.store(true);
+    _thread.join();
+}
+
+void ThreadedMeasurementSampler::run() {
+    using namespace std::chrono;
+    const auto period = duration_cast<steady_clock::duration>(microseconds(1000000 / _rateHz));
+    const auto origin = steady_clock::now();
+    auto next = origin;
+    while (!_stop.load(std::memory_order_relaxed)) {
+        const auto now = steady_clock::now();
+        sample(TimeMs{static_cast<TimeMs::rep>(duration_cast<milliseconds>(now - origin).count())});
+        next += period;
+        if (steady_clock::now() > next + period) next = steady_clock::now();
+        std::this_thread::sleep_until(next);
+    }
+}
+
+#endif
+
+} // namespace WindVane
@@ -0,0 +1,37 @@
+#include "ThreadedAcquisition.h"
+#if !defined(ARDUINO)
+#include <chrono>
+
+ThreadedAcquisition::ThreadedAcquisition(IADC& adc, uint32_t rateHz)
+    : AcquisitionBase(rateHz), _adc(adc) {}
+
+ThreadedAcquisition::~ThreadedAcquisition() { stop(); }
+
+bool ThreadedAcquisition::start() {
+    if (running()) return true;
+    _stop.store(false);
+    _thread = std::thread(&ThreadedAcquisition::run, this);
+    return true;
+}
+
+void ThreadedAcquisition::stop() {
+    if (!running()) return;
+    _stop.store(true);
+    _thread.join();
+}
+
+void ThreadedAcquisition::run() {
+    using namespace std::chrono;
+    const auto period = duration_cast<steady_clock::duration>(microseconds(1000000 / _rateHz));
+    const auto origin = steady_clock::now();
+    auto next = origin;
+    while (!_stop.load(std::memory_order_relaxed)) {
+        const auto now = steady_clock::now();
+        uint16_t code = _adc.readCode();
+        _ring.push({static_cast<uint32_t>(duration_cast<microseconds>(now - origin).count()), code});
+        next += period;
+        if (steady_clock::now() > next + period) next = steady_clock::now();
+        std::this_thread::sleep_until(next);
+    }
+}
+#endif
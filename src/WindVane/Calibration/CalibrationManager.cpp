@@ -26,12 +26,84 @@ CalibrationResult CalibrationManager::runCalibration() {
   return beginCalibration();
 }
 
+CalibrationResult CalibrationManager::startSession(platform::TimeMs now) {
+  CalibrationResult result{};
+  if (status == CalibrationStatus::InProgress) {
+    result.error = "Calibration already running";
+    return result;
+  }
+  if (!calibrationStrategy) {
+    result.error = "No strategy";
+    return result;
+  }
+  statusBeforeSession = status;
+  status = CalibrationStatus::InProgress;
+  calibrationStrategy->beginSession(now);
+  result.success = true;
+  return result;
+}
+
+bool CalibrationManager::stepSession(platform::TimeMs now) {
+  if (status != CalibrationStatus::InProgress || !calibrationStrategy)
+    return false;
+  bool running = calibrationStrategy->step(now);
+  if (!running) updateSessionStatus();
+  return running;
+}
+
+void CalibrationManager::abortSession() {
+  if (status != CalibrationStatus::InProgress || !calibrationStrategy) return;
+  calibrationStrategy->abortSession();
+  updateSessionStatus();
+}
+
+void CalibrationManager::finishSession() {
+  if (status != CalibrationStatus::InProgress || !calibrationStrategy) return;
+  calibrationStrategy->finishSession();
+  updateSessionStatus();
+}
+
+CalibrationProgress CalibrationManager::sessionProgress() const {
+  if (!calibrationStrategy) return CalibrationProgress{};
+  return calibrationStrategy->progress();
+}
+
+void CalibrationManager::updateSessionStatus() {
+  switch (calibrationStrategy->progress().status) {
+  case SessionStatus::Finished:
+    status = CalibrationStatus::Completed;
+    break;
+  case SessionStatus::Aborted:
+    status = statusBeforeSession;
+    break;
+  default:
+    break;
+  }
+}
+
 float CalibrationManager::getCalibratedData(float rawWindDirection) const {
   if (calibrationStrategy)
     return calibrationStrategy->mapReading(rawWindDirection);
   return rawWindDirection * 360.0f;
 }
 
+void CalibrationManager::getCalibratedData(const float* rawReadings,
+                                           float* degrees,
+                                           size_t count) const {
+  if (calibrationStrategy) {
+    calibrationStrategy->mapReadings(rawReadings, degrees, count);
+    return;
+  }
+  for (size_t i = 0; i < count; ++i) degrees[i] = rawReadings[i] * 360.0f;
+}
+
+uint16_t CalibrationManager::getCalibratedCentidegrees(uint16_t rawCode) const {
+  if (calibrationStrategy)
+    return calibrationStrategy->mapCode(rawCode);
+  return static_cast<uint16_t>(
+      (static_cast<uint32_t>(rawCode) * 36000UL + 2047UL) / 4095UL % 36000UL);
+}
+
 void CalibrationManager::editCalibrationData(/*data*/) {}
 
 CalibrationManager::CalibrationStatus CalibrationManager::getStatus() const {
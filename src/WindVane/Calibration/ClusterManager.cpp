@@ -1,5 +1,5 @@
 #include "ClusterManager.h"
-#include <string>
+#include <Instrumentation/LatencyProbe.h>
 
 namespace {
 float normalize360(float angle) {
@@ -7,15 +7,24 @@ float normalize360(float angle) {
     while (angle >= 360.0f) angle -= 360.0f;
     return angle;
 }
+
+constexpr float kMaxCode = static_cast<float>(ClusterManagerBase::kLookupSize - 1);
+
+bool byMean(const ClusterData& a, const ClusterData& b) { return a.mean < b.mean; }
 }
 
-void ClusterManager::clear() {
-    _clusters.clear();
+void ClusterManagerBase::clear() {
+    _count = 0;
+    _fixedCount = 0;
     _anomalyCount = 0;
+    _overflowCount = 0;
+    _lookupValid = false;
 }
 
-bool ClusterManager::addOrUpdate(float reading, float threshold) {
-    for (auto &c : _clusters) {
+bool ClusterManagerBase::addOrUpdate(float reading, float threshold) {
+    _lookupValid = false;
+    for (size_t i = 0; i < _count; ++i) {
+        ClusterData &c = _clusters[i];
         if (std::fabs(reading - c.mean) < threshold) {
             c.mean = (c.mean * c.count + reading) / (c.count + 1);
             c.min = std::min(c.min, reading);
@@ -24,20 +33,27 @@ bool ClusterManager::addOrUpdate(float reading, float threshold) {
             return false;
         }
     }
-    _clusters.push_back({reading, reading, reading, 1});
+    if (_count >= _capacity) {
+        ++_overflowCount;
+        return false;
+    }
+    _clusters[_count++] = {reading, reading, reading, 1};
     return true;
 }
 
-void ClusterManager::mergeAndPrune(float mergeThreshold, int minCount) {
-    if (_clusters.empty())
+void ClusterManagerBase::mergeAndPrune(float mergeThreshold, int minCount) {
+    if (_count == 0) {
+        compileLookup();
         return;
-    std::sort(_clusters.begin(), _clusters.end(), [](const ClusterData &a, const ClusterData &b) { return a.mean < b.mean; });
-    std::vector<ClusterData> merged;
+    }
+    std::sort(_clusters, _clusters + _count, byMean);
+    // Compact in place: the write index never overtakes the read index
+    size_t out = 0;
     size_t i = 0;
-    while (i < _clusters.size()) {
+    while (i < _count) {
         ClusterData cluster = _clusters[i];
         size_t j = i + 1;
-        while (j < _clusters.size() && std::fabs(_clusters[j].mean - cluster.mean) < mergeThreshold) {
+        while (j < _count && std::fabs(_clusters[j].mean - cluster.mean) < mergeThreshold) {
             float total = cluster.count + _clusters[j].count;
             cluster.mean = (cluster.mean * cluster.count + _clusters[j].mean * _clusters[j].count) / total;
             cluster.min = std::min(cluster.min, _clusters[j].min);
@@ -46,54 +62,177 @@ void ClusterManager::mergeAndPrune(float mergeThreshold, int minCount) {
             ++j;
         }
         if (cluster.count >= minCount)
-            merged.push_back(cluster);
+            _clusters[out++] = cluster;
         i = j;
     }
-    _clusters = std::move(merged);
+    _count = out;
+    compileLookup();
 }
 
-void ClusterManager::diagnostics(IDiagnostics &diag) const {
-    std::string msg = "Anomalies detected: " + std::to_string(_anomalyCount);
-    diag.info(msg.c_str());
-    for (size_t i = 0; i < _clusters.size(); ++i) {
+void ClusterManagerBase::diagnostics(IDiagnostics &diag) const {
+    diag.infof("Anomalies detected: %d", _anomalyCount);
+    for (size_t i = 0; i < _count; ++i) {
         float gap = 0;
-        if (i + 1 < _clusters.size())
+        if (i + 1 < _count)
             gap = _clusters[i + 1].mean - _clusters[i].mean;
-        msg = "Cluster " + std::to_string(i) +
-              ": mean=" + std::to_string(_clusters[i].mean) +
-              " min=" + std::to_string(_clusters[i].min) +
-              " max=" + std::to_string(_clusters[i].max) +
-              " count=" + std::to_string(_clusters[i].count) +
-              " gap=" + std::to_string(gap);
-        diag.info(msg.c_str());
+        diag.infof("Cluster %u: mean=%f min=%f max=%f count=%d gap=%f",
+                   static_cast<unsigned>(i), _clusters[i].mean, _clusters[i].min,
+                   _clusters[i].max, _clusters[i].count, gap);
     }
-    if (_clusters.size() > 1) {
-        float expectedGap = 1.0f / _clusters.size();
-        for (size_t i = 0; i + 1 < _clusters.size(); ++i) {
+    if (_count > 1) {
+        float expectedGap = 1.0f / _count;
+        for (size_t i = 0; i + 1 < _count; ++i) {
             float gap = _clusters[i + 1].mean - _clusters[i].mean;
-            if (gap < expectedGap * 0.5f) {
-                msg = "Warning: clusters " + std::to_string(i) + " and " + std::to_string(i + 1) + " very close";
-                diag.warn(msg.c_str());
-            }
-            if (gap > expectedGap * 1.5f) {
-                msg = "Warning: clusters " + std::to_string(i) + " and " + std::to_string(i + 1) + " far apart";
-                diag.warn(msg.c_str());
-            }
+            if (gap < expectedGap * 0.5f)
+                diag.warnf("Warning: clusters %u and %u very close",
+                           static_cast<unsigned>(i), static_cast<unsigned>(i + 1));
+            if (gap > expectedGap * 1.5f)
+                diag.warnf("Warning: clusters %u and %u far apart",
+                           static_cast<unsigned>(i), static_cast<unsigned>(i + 1));
+        }
+    }
+    if (_overflowCount > 0)
+        diag.warnf("Warning: %d readings exceeded cluster capacity %u",
+                   _overflowCount, static_cast<unsigned>(_capacity));
+}
+
+bool ClusterManagerBase::setClusters(const ClusterData* clusters, size_t count) {
+    const bool fits = count <= _capacity;
+    _count = fits ? count : _capacity;
+    std::copy(clusters, clusters + _count, _clusters);
+    std::sort(_clusters, _clusters + _count, byMean);
+    compileLookup();
+    return fits;
+}
+
+float ClusterManagerBase::interpolate(float reading) const {
+    WINDVANE_PROBE(Interpolate);
+    if (!_lookupValid || !(reading >= 0.0f && reading <= 1.0f))
+        return interpolateScan(reading);
+#if WINDVANE_FIXED_POINT
+    return interpolateCode(static_cast<uint16_t>(reading * kMaxCode + 0.5f)) * 0.01f;
+#else
+    return _lookup[static_cast<size_t>(reading * kMaxCode + 0.5f)];
+#endif
+}
+
+float ClusterManagerBase::lookup(uint16_t code) const {
+    if (code >= kLookupSize)
+        code = static_cast<uint16_t>(kLookupSize - 1);
+    if (!_lookupValid)
+        return interpolateScan(code / kMaxCode);
+#if WINDVANE_FIXED_POINT
+    return interpolateCode(code) * 0.01f;
+#else
+    return _lookup[code];
+#endif
+}
+
+uint16_t ClusterManagerBase::interpolateCode(uint16_t code) const {
+    using namespace fixed_point;
+    const uint32_t q = codeToQ16(code);
+    const uint32_t n = static_cast<uint32_t>(_fixedCount);
+    if (n == 0)
+        return static_cast<uint16_t>((q * kCentidegreesPerRev + kQ16One / 2) /
+                                     kQ16One % kCentidegreesPerRev);
+
+    // Locate the segment [mean_seg, mean_seg+1) holding q; before the first
+    // boundary the reading belongs to the wrapped segment after the last.
+    uint32_t seg, offset, span;
+    const uint32_t first = _fixed[0].mean;
+    const uint32_t last = _fixed[n - 1].mean;
+    if (q < first) {
+        seg = n - 1;
+        offset = kQ16One - last + q;
+        span = kQ16One - last + first;
+    } else {
+        uint32_t lo = 0, hi = n - 1;
+        while (lo < hi) {
+            uint32_t mid = (lo + hi + 1) / 2;
+            if (_fixed[mid].mean <= q) lo = mid;
+            else hi = mid - 1;
         }
+        seg = lo;
+        const uint32_t curr = _fixed[seg].mean;
+        const uint32_t next = seg + 1 < n ? _fixed[seg + 1].mean : first + kQ16One;
+        offset = q - curr;
+        span = next - curr;
+    }
+    if (span == 0)
+        span = 1;
+    // offset <= span <= 2^16, so offset * 36000 stays below 2^32
+    const uint32_t frac = (offset * kCentidegreesPerRev + span / 2) / span;
+    const uint32_t angle = (seg * kCentidegreesPerRev + frac + n / 2) / n;
+    return static_cast<uint16_t>(angle % kCentidegreesPerRev);
+}
+
+void ClusterManagerBase::interpolateBatch(const float* readings, float* degrees,
+                                      size_t count) const {
+#if WINDVANE_FIXED_POINT
+    for (size_t i = 0; i < count; ++i)
+        degrees[i] = interpolate(readings[i]);
+#else
+    if (!_lookupValid) {
+        for (size_t i = 0; i < count; ++i)
+            degrees[i] = interpolateScan(readings[i]);
+        return;
+    }
+    // Branch-free body: clamp (NaN maps to code 0) then a table gather
+    const float* table = _lookup;
+    for (size_t i = 0; i < count; ++i) {
+        float scaled = std::min(kMaxCode, std::max(0.0f, readings[i] * kMaxCode + 0.5f));
+        degrees[i] = table[static_cast<size_t>(scaled)];
     }
+#endif
 }
 
-void ClusterManager::setClusters(const std::vector<ClusterData>& clusters) {
-    _clusters = clusters;
-    std::sort(_clusters.begin(), _clusters.end(),
-              [](const ClusterData& a, const ClusterData& b){ return a.mean < b.mean; });
+// Converts the sorted clusters to Q0.16 boundaries and, on FPU targets,
+// fills the table in a single sweep over them, evaluating the same
+// expressions as interpolateScan so both paths agree for every code.
+void ClusterManagerBase::compileLookup() {
+    for (size_t i = 0; i < _count; ++i) {
+        const ClusterData& c = _clusters[i];
+        _fixed[i] = {fixed_point::toQ16(c.mean), fixed_point::toQ16(c.min),
+                     fixed_point::toQ16(c.max),
+                     static_cast<uint16_t>(std::min(c.count, 0xFFFF))};
+    }
+    _fixedCount = _count;
+    _lookupValid = true;
+#if !WINDVANE_FIXED_POINT
+    const size_t n = _count;
+    size_t seg = 0;
+    for (size_t code = 0; code < kLookupSize; ++code) {
+        const float reading = code / kMaxCode;
+        if (n == 0) {
+            _lookup[code] = normalize360(reading * 360.0f);
+            continue;
+        }
+        if (reading < _clusters[0].mean) {
+            float prev = _clusters[_count - 1].mean;
+            float curr = _clusters[0].mean;
+            float total_gap = (1.0f - prev) + curr;
+            float reading_gap = (1.0f - prev) + reading;
+            float ratio = reading_gap / total_gap;
+            float angle = (n - 1 + ratio) * 360.0f / n;
+            _lookup[code] = normalize360(angle);
+            continue;
+        }
+        while (seg + 1 < n && reading >= _clusters[seg + 1].mean)
+            ++seg;
+        const float curr = _clusters[seg].mean;
+        const float next = (seg + 1 < n) ? _clusters[seg + 1].mean : _clusters[0].mean + 1.0f;
+        float ratio = (reading - curr) / (next - curr);
+        float angle = (seg + ratio) * 360.0f / n;
+        _lookup[code] = normalize360(angle);
+    }
+#endif
 }
 
-float ClusterManager::interpolate(float reading) const {
-    if (_clusters.empty())
+float ClusterManagerBase::interpolateScan(float reading) const {
+    if (_count == 0)
         return normalize360(reading * 360.0f);
 
-    size_t n = _clusters.size();
+    size_t n = _count;
     
     // Additional safety check - should never happen but prevents crashes
     if (n == 0) {
@@ -101,10 +240,10 @@ float ClusterManager::interpolate(float reading) const {
     }
     
     // handle wrap-around before first cluster
-    if (reading < _clusters.front().mean) {
+    if (reading < _clusters[0].mean) {
         // Handle wrap-around case: reading is between last cluster (wrapped) and first cluster
-        float prev = _clusters.back().mean;
-        float curr = _clusters.front().mean;
+        float prev = _clusters[_count - 1].mean;
+        float curr = _clusters[0].mean;
         // Calculate distance considering wrap-around (reading + 1.0 to handle the wrap)
         float total_gap = (1.0f - prev) + curr;
         float reading_gap = (1.0f - prev) + reading;
@@ -122,8 +261,8 @@ float ClusterManager::interpolate(float reading) const {
         }
     }
     // if reading >= last cluster mean
-    float ratio = (reading - _clusters.back().mean) /
-                  (_clusters.front().mean + 1.0f - _clusters.back().mean);
+    float ratio = (reading - _clusters[_count - 1].mean) /
+                  (_clusters[0].mean + 1.0f - _clusters[_count - 1].mean);
     float angle = (n - 1 + ratio) * 360.0f / n;
     return normalize360(angle);
 }
@@ -0,0 +1,60 @@
+#include "NoiseWindow.h"
+#include <algorithm>
+#include <cmath>
+
+uint16_t NoiseWindow::toCode(float reading) {
+    if (!(reading > 0.0f)) return 0;
+    if (reading >= 1.0f) return fixed_point::kMaxCode;
+    return static_cast<uint16_t>(reading * fixed_point::kMaxCode + 0.5f);
+}
+
+void NoiseWindow::reset(int size) {
+    _window = static_cast<size_t>(std::clamp(size, 1, static_cast<int>(kCapacity)));
+    _head = 0;
+    _count = 0;
+    _tree.fill(0);
+}
+
+void NoiseWindow::push(float reading) {
+    const bool useTree = _window > kScanWindow;
+    if (_count == _window) {
+        if (useTree) treeAdd(toCode(_ring[_head]), -1);
+    } else {
+        ++_count;
+    }
+    _ring[_head] = reading;
+    if (useTree) treeAdd(toCode(reading), 1);
+    if (++_head == _window) _head = 0;
+}
+
+size_t NoiseWindow::countWithin(float reading, float threshold) const {
+    if (_window <= kScanWindow) {
+        size_t inRange = 0;
+        for (size_t i = 0; i < _count; ++i) {
+            if (std::fabs(_ring[i] - reading) < threshold)
+                ++inRange;
+        }
+        return inRange;
+    }
+
+    const int code = toCode(reading);
+    // |a - b| < t over integers is |a - b| < ceil(t) for real t
+    const int span = static_cast<int>(std::ceil(threshold * fixed_point::kMaxCode));
+    if (span <= 0) return 0;
+
+    const size_t lo = static_cast<size_t>(std::max(code - span + 1, 0));
+    const size_t hi = static_cast<size_t>(std::min(code + span, static_cast<int>(kCodeCount)));
+    return treeCountBelow(hi) - treeCountBelow(lo);
+}
+
+void NoiseWindow::treeAdd(uint16_t code, int delta) {
+    for (size_t i = code + 1u; i <= kCodeCount; i += i & (~i + 1))
+        _tree[i] = static_cast<uint8_t>(_tree[i] + delta);
+}
+
+size_t NoiseWindow::treeCountBelow(size_t end) const {
+    size_t total = 0;
+    for (size_t i = end; i > 0; i &= i - 1)
+        total += _tree[i];
+    return total;
+}
@@ -7,88 +7,124 @@
 #include <cmath>
 #include <algorithm>
 #include <thread>
-#include <string>
-
-using namespace std::chrono_literals;
-
 
 SpinningMethod::SpinningMethod(const SpinningMethodDeps &deps)
     : _adc(deps.adc), _storage(deps.storage),
       _diag(deps.diag), _config(deps.config) {
-  int version = 0;
-  std::vector<ClusterData> clusters;
-  if (_storage.load(clusters, version).ok())
-    _clusterMgr.setClusters(clusters);
+  loadCalibration();
+  _saveBuffer.reserve(_clusterMgr.capacity());
 }
 
-
+void SpinningMethod::loadCalibration() {
+  int version = 0;
+  if (_storage.load(_saveBuffer, version).ok())
+    _clusterMgr.setClusters(_saveBuffer);
+  else
+    _clusterMgr.clear();
+}
 
 void SpinningMethod::saveCalibration() const {
-  StorageResult res = _storage.save(_clusterMgr.clusters(), CALIBRATION_VERSION);
+  auto clusters = _clusterMgr.clusters();
+  _saveBuffer.assign(clusters.begin(), clusters.end());
+  StorageResult res = _storage.save(_saveBuffer, CALIBRATION_VERSION);
   if (!res.ok()) {
     _diag.warn("Failed to save calibration");
   }
 }
 
 void SpinningMethod::calibrate() {
-  SessionState state;
-  initSession(state);
-
   const std::chrono::milliseconds sampleDelay(_config.sampleDelayMs);
-  const std::chrono::seconds stallTimeout(_config.stallTimeoutSec);
+  beginSession(platform::now());
+  while (step(platform::now()))
+    std::this_thread::sleep_for(sampleDelay);
+}
+
+void SpinningMethod::beginSession(platform::TimeMs now) {
+  initSession(_session);
+  _session.started = now;
+  _session.sampleTime = now;
+  _session.nextSample = now;
+  _session.lastIncrease = now;
+  _status = SessionStatus::Running;
+}
+
+bool SpinningMethod::step(platform::TimeMs now) {
+  if (_status != SessionStatus::Running) return false;
+  // Signed difference so the check survives millis() wrap-around
+  if (static_cast<int32_t>((now - _session.nextSample).count()) < 0) return true;
+
+  _session.sampleTime = now;
+  _session.nextSample =
+      now + platform::TimeMs{static_cast<platform::TimeMs::rep>(_config.sampleDelayMs)};
+  float reading = _adc.read();
+  const platform::TimeMs stallTimeout{
+      static_cast<platform::TimeMs::rep>(_config.stallTimeoutSec) * 1000U};
+  if (checkStall(now, _session.lastIncrease, stallTimeout))
+    _session.stop = true;
 
-  runSession(state, sampleDelay, stallTimeout);
+  processReading(reading, _session);
 
-  finalizeCalibration(state.abort, _config.threshold * 1.5f);
+  if (_session.stop) endSession();
+  return _status == SessionStatus::Running;
 }
 
-void SpinningMethod::runSession(SessionState &state,
-                                std::chrono::milliseconds delay,
-                                std::chrono::seconds timeout) {
-  while (!state.stop) {
-    float reading = _adc.read();
-    if (checkStall(std::chrono::steady_clock::now(), state.lastIncrease,
-                   timeout))
-      state.stop = true;
+void SpinningMethod::abortSession() {
+  if (_status != SessionStatus::Running) return;
+  _session.abort = true;
+  endSession();
+}
 
-    processReading(reading, state);
-    std::this_thread::sleep_for(delay);
-  }
+void SpinningMethod::finishSession() {
+  if (_status != SessionStatus::Running) return;
+  endSession();
+}
+
+CalibrationProgress SpinningMethod::progress() const {
+  CalibrationProgress p;
+  p.status = _status;
+  p.detected = _clusterMgr.clusters().size();
+  p.expected = static_cast<size_t>(_config.expectedPositions);
+  p.anomalies = _clusterMgr.anomalies();
+  p.elapsed = _session.sampleTime - _session.started;
+  return p;
+}
+
+void SpinningMethod::endSession() {
+  _session.stop = true;
+  finalizeCalibration(_session.abort, _config.threshold * 1.5f);
+  _status = _session.abort ? SessionStatus::Aborted : SessionStatus::Finished;
 }
 
 float SpinningMethod::mapReading(float reading) const {
   return _clusterMgr.interpolate(reading);
 }
 
-bool SpinningMethod::checkStall(std::chrono::steady_clock::time_point now,
-                                std::chrono::steady_clock::time_point &last,
-                                const std::chrono::seconds &timeout) const {
-  if (now - last > timeout) {
-    return true;
-  }
-  return false;
+void SpinningMethod::mapReadings(const float* readings, float* degrees,
+                                 size_t count) const {
+  _clusterMgr.interpolateBatch(readings, degrees, count);
+}
+
+uint16_t SpinningMethod::mapCode(uint16_t code) const {
+  return _clusterMgr.interpolateCode(code);
+}
+
+bool SpinningMethod::checkStall(platform::TimeMs now, platform::TimeMs last,
+                                platform::TimeMs timeout) const {
+  return now - last > timeout;
 }
 
 void SpinningMethod::updateClusters(float reading, SessionState &state) {
-  _recent.push_back(reading);
-  if (_recent.size() > static_cast<size_t>(_config.bufferSize))
-    _recent.pop_front();
-
-  int inRange = 0;
-  for (float r : _recent) {
-    if (std::fabs(r - reading) < _config.threshold)
-      ++inRange;
-  }
+  _recent.push(reading);
+  size_t inRange = _recent.countWithin(reading, _config.threshold);
 
-  if (inRange > static_cast<int>(_recent.size()) / 2) {
+  if (inRange > _recent.size() / 2) {
     bool added = _clusterMgr.addOrUpdate(reading, _config.threshold);
     if (_clusterMgr.clusters().size() != state.previousCount) {
-      std::string msg = "Position detected: " +
-                        std::to_string(_clusterMgr.clusters().size()) + "/" +
-                        std::to_string(_config.expectedPositions);
-      _diag.info(msg.c_str());
+      _diag.infof("Position detected: %u/%d",
+                  static_cast<unsigned>(_clusterMgr.clusters().size()),
+                  _config.expectedPositions);
       state.previousCount = _clusterMgr.clusters().size();
-      state.lastIncrease = std::chrono::steady_clock::now();
+      state.lastIncrease = state.sampleTime;
       if (_clusterMgr.clusters().size() >= static_cast<size_t>(_config.expectedPositions)) {
         state.stop = true;
       }
@@ -105,21 +141,25 @@ void SpinningMethod::finalizeCalibration(bool abort, float mergeThreshold) {
     _clusterMgr.diagnostics(_diag);
     saveCalibration();
   } else {
+    loadCalibration();
     _diag.info("Calibration aborted. Previous data preserved.");
   }
 }
 
 void SpinningMethod::initSession(SessionState &state) {
   _clusterMgr.clear();
-  _recent.clear();
+  _recent.reset(_config.bufferSize);
   state = SessionState{}; // reset fields
 }
 
 void SpinningMethod::processReading(float reading, SessionState &state) {
-  if (reading <= 0.0f || reading >= 1.0f) {
+  // Negated so NaN is rejected along with out-of-range readings
+  if (!(reading > 0.0f && reading < 1.0f)) {
+    WINDVANE_LOG_DEBUG(_diag, "Rejected reading %f", reading);
     _clusterMgr.recordAnomaly();
     return;
   }
+  WINDVANE_LOG_DEBUG(_diag, "Reading %f", reading);
 
   updateClusters(reading, state);
 
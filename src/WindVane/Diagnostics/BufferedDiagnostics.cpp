@@ -0,0 +1,45 @@
+#include "BufferedDiagnostics.h"
+#include <cstdio>
+
+size_t DiagnosticsRecord::format(char* buf, size_t size) const {
+    int n = snprintf(buf, size, "[%lu] %s: %s", static_cast<unsigned long>(timestampMs),
+                     levelName(level), text);
+    if (n < 0) return 0;
+    return static_cast<size_t>(n) < size ? static_cast<size_t>(n) : size - 1;
+}
+
+BufferedDiagnostics::BufferedDiagnostics(size_t maxEntries, IOutput* out)
+    : _capacity(maxEntries ? maxEntries : 1),
+      _records(new DiagnosticsRecord[_capacity]),
+      _out(out) {
+    if (_out) {
+        char msg[64];
+        snprintf(msg, sizeof(msg), "Diagnostics history: %u records, %u bytes",
+                 static_cast<unsigned>(_capacity), static_cast<unsigned>(memoryBytes()));
+        _out->writeln(msg);
+    }
+}
+
+void BufferedDiagnostics::handle(const DiagnosticsEvent& ev) {
+    DiagnosticsRecord& rec = _records[_head];
+    rec.timestampMs = static_cast<uint32_t>(platform::toEmbedded(ev.timestamp));
+    rec.level = ev.level;
+    ev.render(rec.text, sizeof(rec.text));
+    _head = (_head + 1) % _capacity;
+    if (_count < _capacity) ++_count;
+    if (_out) {
+        // Plain messages echo whole; only formatted events and the
+        // retained copy are clipped
+        char prefix[32];
+        snprintf(prefix, sizeof(prefix), "[%lu] %s: ",
+                 static_cast<unsigned long>(rec.timestampMs), levelName(rec.level));
+        char buf[128];
+        const char* text = ev.plainText();
+        if (!text) {
+            ev.render(buf, sizeof(buf));
+            text = buf;
+        }
+        _out->write(prefix);
+        _out->writeln(text);
+    }
+}
@@ -0,0 +1,117 @@
+#include "DiagnosticsBus.h"
+
+#if !defined(ARDUINO)
+#include <chrono>
+#endif
+
+DiagnosticsBus::~DiagnosticsBus() {
+#if !defined(ARDUINO)
+    stopAsync();
+#else
+    drainRemaining();
+#endif
+}
+
+void DiagnosticsBus::addSink(IDiagnosticsSink* sink, uint8_t levelMask) {
+    if (!sink) return;
+    _sinks.push_back({sink, levelMask});
+    updateLevels();
+}
+
+void DiagnosticsBus::removeSink(IDiagnosticsSink* sink) {
+    _sinks.erase(std::remove_if(_sinks.begin(), _sinks.end(),
+                                [sink](const SinkEntry& e) { return e.sink == sink; }),
+                 _sinks.end());
+    updateLevels();
+}
+
+void DiagnosticsBus::setSinkLevels(IDiagnosticsSink* sink, uint8_t levelMask) {
+    for (auto& e : _sinks)
+        if (e.sink == sink) e.levels = levelMask;
+    updateLevels();
+}
+
+void DiagnosticsBus::updateLevels() {
+    _levels = 0;
+    for (const auto& e : _sinks) _levels |= e.levels;
+}
+
+void DiagnosticsBus::dispatch(DiagnosticsEvent ev) {
+    ev.timestamp = platform::now();
+    Queue* queue = _active.load(std::memory_order_acquire);
+    if (!queue) {
+        deliver(ev);
+        return;
+    }
+    // The caller's string will not outlive the queue slot
+    ev.detach();
+    if (queue->push(ev))
+        _accepted.fetch_add(1, std::memory_order_release);
+    else
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+void DiagnosticsBus::enableQueue() {
+    if (!_queue) _queue = std::make_unique<Queue>();
+    _active.store(_queue.get(), std::memory_order_release);
+}
+
+size_t DiagnosticsBus::drain(size_t maxEvents) {
+    if (!_queue) return 0;
+    size_t count = 0;
+    DiagnosticsEvent ev;
+    while (count < maxEvents && _queue->pop(ev)) {
+        deliver(ev);
+        ++count;
+    }
+    _delivered.fetch_add(static_cast<uint32_t>(count), std::memory_order_release);
+    // Overflow is reported in-band once the queue has room to breathe
+    const uint32_t drops = _dropped.load(std::memory_order_relaxed);
+    if (drops != _reportedDrops) {
+        auto ev = DiagnosticsEvent::structured(LogLevel::Warn, "Diagnostics queue dropped %u events",
+                                               drops - _reportedDrops);
+        ev.timestamp = platform::now();
+        deliver(ev);
+        _reportedDrops = drops;
+    }
+    return count;
+}
+
+void DiagnosticsBus::drainRemaining() {
+    if (!queued()) return;
+    _active.store(nullptr, std::memory_order_release);
+    while (drain() > 0) {
+    }
+}
+
+#if !defined(ARDUINO)
+
+void DiagnosticsBus::startAsync() {
+    if (async()) return;
+    enableQueue();
+    _stop.store(false);
+    _drainThread = std::thread([this] {
+        while (!_stop.load(std::memory_order_acquire)) {
+            if (drain() == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+}
+
+void DiagnosticsBus::flush() {
+    if (!queued()) return;
+    const uint32_t target = _accepted.load(std::memory_order_acquire);
+    while (static_cast<int32_t>(_delivered.load(std::memory_order_acquire) - target) < 0) {
+        if (async()) std::this_thread::yield();
+        else drain();
+    }
+}
+
+void DiagnosticsBus::stopAsync() {
+    if (async()) {
+        _stop.store(true, std::memory_order_release);
+        _drainThread.join();
+    }
+    drainRemaining();
+}
+
+#endif
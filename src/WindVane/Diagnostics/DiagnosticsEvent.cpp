@@ -0,0 +1,95 @@
+#include "DiagnosticsEvent.h"
+#include <cstdio>
+#include <cstring>
+
+DiagnosticsEvent DiagnosticsEvent::plain(LogLevel level, const char* msg) {
+    DiagnosticsEvent ev = borrowed(level, msg);
+    ev.detach();
+    return ev;
+}
+
+DiagnosticsEvent DiagnosticsEvent::borrowed(LogLevel level, const char* msg) {
+    DiagnosticsEvent ev;
+    ev.level = level;
+    ev.message = msg;
+    return ev;
+}
+
+void DiagnosticsEvent::detach() {
+    if (!message) return;
+    strncpy(text, message, kTextSize - 1);
+    text[kTextSize - 1] = '\0';
+    message = nullptr;
+}
+
+namespace {
+
+// Formats one conversion spec (e.g. "%5.2f") with a captured argument,
+// coercing the argument to whatever the conversion expects.
+int renderArg(char* out, size_t size, const char* spec, char conv, const DiagnosticsArg& arg) {
+    switch (conv) {
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': {
+        double v = arg.type == DiagnosticsArg::Type::Float ? arg.f
+                   : arg.type == DiagnosticsArg::Type::Int ? arg.i
+                   : arg.type == DiagnosticsArg::Type::Uint ? arg.u : 0.0;
+        return snprintf(out, size, spec, v);
+    }
+    case 's':
+        return snprintf(out, size, spec, arg.type == DiagnosticsArg::Type::Str && arg.s ? arg.s : "?");
+    case 'c': {
+        // A NUL here would end the rendered line early
+        int c = arg.type == DiagnosticsArg::Type::Float ? static_cast<int>(arg.f)
+                : arg.type == DiagnosticsArg::Type::Str ? 0 : static_cast<int>(arg.i);
+        return snprintf(out, size, spec, c ? c : '?');
+    }
+    case 'd': case 'i':
+        return snprintf(out, size, spec,
+                        arg.type == DiagnosticsArg::Type::Float ? static_cast<int>(arg.f)
+                        : arg.type == DiagnosticsArg::Type::Str ? 0 : static_cast<int>(arg.i));
+    default: // u, x, X, o
+        return snprintf(out, size, spec,
+                        arg.type == DiagnosticsArg::Type::Float ? static_cast<unsigned>(arg.f)
+                        : arg.type == DiagnosticsArg::Type::Str ? 0u : static_cast<unsigned>(arg.u));
+    }
+}
+
+} // namespace
+
+size_t DiagnosticsEvent::render(char* buf, size_t size) const {
+    if (size == 0) return 0;
+    if (!format) {
+        strncpy(buf, plainText(), size - 1);
+        buf[size - 1] = '\0';
+        return strlen(buf);
+    }
+    size_t len = 0;
+    size_t next = 0;
+    const char* p = format;
+    while (*p && len + 1 < size) {
+        if (*p != '%') {
+            buf[len++] = *p++;
+            continue;
+        }
+        if (p[1] == '%') {
+            buf[len++] = '%';
+            p += 2;
+            continue;
+        }
+        // Copy "%[flags][width][.precision]conv", dropping length modifiers
+        char spec[16];
+        size_t s = 0;
+        spec[s++] = *p++;
+        while (*p && strchr("-+ #0123456789.", *p) && s < sizeof(spec) - 3) spec[s++] = *p++;
+        while (*p && strchr("hlLjzt", *p)) ++p;
+        if (!*p) break;
+        const char conv = *p++;
+        spec[s++] = conv;
+        spec[s] = '\0';
+        if (next >= argCount) continue;
+        int n = renderArg(buf + len, size - len, spec, conv, args[next++]);
+        if (n > 0) len += static_cast<size_t>(n);
+        if (len >= size) len = size - 1;
+    }
+    buf[len] = '\0';
+    return len;
+}
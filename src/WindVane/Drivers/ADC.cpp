@@ -1,4 +1,5 @@
 #include "ADC.h"
+#include <Instrumentation/LatencyProbe.h>
 
 #ifdef UNIT_TEST
   #include "ArduinoFake.h"
@@ -8,11 +9,16 @@
 
 float ESP32ADC::read() const { 
     // ESP32 ADC returns 0-4095, normalize to 0.0-1.0
+    return static_cast<float>(readCode()) / 4095.0f; 
+}
+
+uint16_t ESP32ADC::readCode() const {
+    WINDVANE_PROBE(AdcRead);
     int rawValue = analogRead(_pin);
     
     // Clamp to valid range (defensive programming)
     if (rawValue < 0) rawValue = 0;
     if (rawValue > 4095) rawValue = 4095;
     
-    return static_cast<float>(rawValue) / 4095.0f; 
+    return static_cast<uint16_t>(rawValue);
 }
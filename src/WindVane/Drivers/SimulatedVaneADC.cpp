@@ -0,0 +1,130 @@
+#include "SimulatedVaneADC.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+float wrap360(float deg) {
+  deg -= 360.0f * std::floor(deg / 360.0f);
+  return deg >= 360.0f ? 0.0f : deg;
+}
+
+} // namespace
+
+RotationScript& RotationScript::hold(float deg, uint32_t samples) {
+  if (samples) _segments.push_back({deg, 0.0f, samples});
+  return *this;
+}
+
+RotationScript& RotationScript::sweep(float fromDeg, float toDeg, uint32_t samples) {
+  if (samples)
+    _segments.push_back({fromDeg, (toDeg - fromDeg) / samples, samples});
+  return *this;
+}
+
+RotationScript& RotationScript::spin(float startDeg, float turns, uint32_t samples) {
+  return sweep(startDeg, startDeg + 360.0f * turns, samples);
+}
+
+RotationScript& RotationScript::loop(bool enable) {
+  _loop = enable;
+  return *this;
+}
+
+SimulatedVaneADC::SimulatedVaneADC(const SimulatedVaneConfig& cfg)
+    : _cfg(cfg),
+      _spacingDeg(cfg.resistorsOhms.empty() ? 360.0f : 360.0f / cfg.resistorsOhms.size()),
+      _rng(cfg.seed ? cfg.seed : 1) {
+  const size_t n = _cfg.resistorsOhms.size();
+  _stateCodes.reserve(2 * n + 1);
+  for (float r : _cfg.resistorsOhms) _stateCodes.push_back(toCode(r));
+  for (size_t i = 0; i < n; ++i) {
+    float a = _cfg.resistorsOhms[i];
+    float b = _cfg.resistorsOhms[(i + 1) % n];
+    _stateCodes.push_back(toCode(a * b / (a + b)));
+  }
+  _stateCodes.push_back(4095.0f); // open circuit: pulled to the supply
+  _settled = classify(_angle);
+}
+
+size_t SimulatedVaneADC::positions() const {
+  const size_t n = _cfg.resistorsOhms.size();
+  return 2.0f * _cfg.closeHalfWidthDeg > _spacingDeg ? 2 * n : n;
+}
+
+uint16_t SimulatedVaneADC::idealCode(float deg) const {
+  return static_cast<uint16_t>(_stateCodes[classify(wrap360(deg))] + 0.5f);
+}
+
+void SimulatedVaneADC::setScript(const RotationScript& script) {
+  _script = script;
+  _segment = 0;
+  _offset = 0;
+}
+
+void SimulatedVaneADC::setAngle(float deg) {
+  _script = RotationScript{};
+  _angle = wrap360(deg);
+}
+
+float SimulatedVaneADC::toCode(float ohms) const {
+  // Vane ladder to ground, pull-up to the supply
+  float v = ohms / (ohms + _cfg.pullupOhms);
+  float x = std::min(1.0f, v / _cfg.saturation);
+  float y = x + _cfg.nonlinearity * 4.0f * x * (1.0f - x);
+  return std::clamp(y, 0.0f, 1.0f) * 4095.0f;
+}
+
+size_t SimulatedVaneADC::classify(float deg) const {
+  const size_t n = _cfg.resistorsOhms.size();
+  if (n == 0) return openState();
+  float pos = deg / _spacingDeg;
+  size_t i = static_cast<size_t>(pos) % n;
+  float fromLow = (pos - std::floor(pos)) * _spacingDeg;
+  bool lowClosed = fromLow < _cfg.closeHalfWidthDeg;
+  bool highClosed = _spacingDeg - fromLow < _cfg.closeHalfWidthDeg;
+  if (lowClosed && highClosed) return n + i;
+  if (lowClosed) return i;
+  if (highClosed) return (i + 1) % n;
+  return openState();
+}
+
+void SimulatedVaneADC::advance() const {
+  if (_script._segments.empty()) return;
+  if (_segment >= _script._segments.size()) return; // finished, holding
+  const RotationScript::Segment& seg = _script._segments[_segment];
+  _angle = wrap360(seg.start + seg.step * _offset);
+  if (++_offset < seg.samples) return;
+  _offset = 0;
+  if (++_segment == _script._segments.size() && _script._loop) _segment = 0;
+}
+
+float SimulatedVaneADC::gaussian() const {
+  // xorshift64*, then Irwin-Hall over four bytes: cheap and close enough to
+  // normal for ADC noise
+  _rng ^= _rng >> 12;
+  _rng ^= _rng << 25;
+  _rng ^= _rng >> 27;
+  uint64_t r = _rng * 0x2545F4914F6CDD1DULL;
+  int sum = static_cast<int>((r & 0xFF) + ((r >> 8) & 0xFF) +
+                             ((r >> 16) & 0xFF) + ((r >> 24) & 0xFF));
+  _bounceBit = (r >> 63) != 0;
+  return (sum - 510) * (1.0f / 147.8f);
+}
+
+uint16_t SimulatedVaneADC::readCode() const {
+  advance();
+  size_t state = classify(_angle);
+  if (state != _settled) {
+    _settled = state;
+    _bounceLeft = _cfg.bounceSamples;
+  }
+  float noise = gaussian();
+  size_t shown = state;
+  if (_bounceLeft) {
+    --_bounceLeft;
+    if (_bounceBit) shown = openState(); // contacts momentarily apart
+  }
+  float code = _stateCodes[shown] + noise * _cfg.noiseCodes;
+  return static_cast<uint16_t>(std::clamp(code + 0.5f, 0.0f, 4095.0f));
+}
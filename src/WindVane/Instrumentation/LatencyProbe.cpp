@@ -0,0 +1,82 @@
+#include "LatencyProbe.h"
+
+const char* probeName(Probe probe) {
+    switch (probe) {
+    case Probe::AdcRead: return "ADC read";
+    case Probe::Interpolate: return "Interpolate";
+    case Probe::StatusLine: return "Status line";
+    case Probe::StorageSave: return "Storage save";
+    case Probe::MenuUpdate: return "Menu update";
+    default: return "?";
+    }
+}
+
+size_t LatencyHistogram::bucketFor(uint32_t us) {
+    constexpr uint32_t kSub = 1u << kSubBits;
+    if (us < kSub) return us;
+    unsigned octave = 31;
+    while (!(us >> octave)) --octave;
+    const uint32_t sub = (us >> (octave - kSubBits)) & (kSub - 1);
+    return ((octave - kSubBits + 1) << kSubBits) + sub;
+}
+
+uint32_t LatencyHistogram::bucketUpperBound(size_t bucket) {
+    constexpr uint32_t kSub = 1u << kSubBits;
+    if (bucket < kSub) return static_cast<uint32_t>(bucket);
+    const unsigned octave = static_cast<unsigned>(bucket >> kSubBits) + kSubBits - 1;
+    const uint32_t sub = bucket & (kSub - 1);
+    const uint64_t base = (static_cast<uint64_t>(kSub + sub)) << (octave - kSubBits);
+    const uint64_t upper = base + (1ull << (octave - kSubBits)) - 1;
+    return upper > 0xFFFFFFFFull ? 0xFFFFFFFFu : static_cast<uint32_t>(upper);
+}
+
+void LatencyHistogram::record(uint32_t us) {
+    _buckets[bucketFor(us)].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    uint32_t prev = _max.load(std::memory_order_relaxed);
+    while (us > prev && !_max.compare_exchange_weak(prev, us, std::memory_order_relaxed)) {
+    }
+}
+
+void LatencyHistogram::reset() {
+    for (auto& b : _buckets) b.store(0, std::memory_order_relaxed);
+    _count.store(0, std::memory_order_relaxed);
+    _max.store(0, std::memory_order_relaxed);
+}
+
+uint32_t LatencyHistogram::percentile(float fraction) const {
+    const uint32_t total = count();
+    if (total == 0) return 0;
+    uint32_t rank = static_cast<uint32_t>(fraction * total + 0.5f);
+    if (rank < 1) rank = 1;
+    uint32_t seen = 0;
+    for (size_t i = 0; i < kBuckets; ++i) {
+        seen += _buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            const uint32_t bound = bucketUpperBound(i);
+            return bound < max() ? bound : max();
+        }
+    }
+    return max();
+}
+
+LatencyProbes& LatencyProbes::instance() {
+    static LatencyProbes probes;
+    return probes;
+}
+
+ProbeSummary LatencyProbes::summary(Probe probe) const {
+    const LatencyHistogram& h = histogram(probe);
+    return {probeName(probe), h.count(), h.percentile(0.5f), h.percentile(0.99f), h.max()};
+}
+
+float LatencyProbes::loopRateHz(platform::TimeMs now) const {
+    const uint32_t elapsed = platform::toEmbedded(now) - _sinceMs.load(std::memory_order_relaxed);
+    if (elapsed == 0) return 0.0f;
+    return histogram(Probe::MenuUpdate).count() * 1e3f / elapsed;
+}
+
+void LatencyProbes::reset() {
+    for (auto& h : _histograms) h.reset();
+    _sinceMs.store(platform::toEmbedded(platform::now()), std::memory_order_relaxed);
+}
@@ -30,7 +30,7 @@ void DiagnosticsMenu::renderScreen(size_t index, platform::TimeMs lastCalibratio
     model.status = _vane.getCalibrationStatus();
     model.minutesSinceCalibration = _view.platform().millis() - lastCalibration;
     if (_buffered)
-        model.history = &_buffered->get().history();
+        model.history = &_buffered->get();
     else
         model.history = nullptr;
     _view.render(model, index);
@@ -39,14 +39,20 @@ void DiagnosticsMenu::renderScreen(size_t index, platform::TimeMs lastCalibratio
 DiagnosticsMenu::ActionResult DiagnosticsMenu::handleAction(char c, size_t index) const {
     ActionResult out{index, false};
     if (c=='N'||c=='n') {
-        if (_buffered && index+5<_buffered->get().history().size()) out.index+=5;
+        if (_buffered && index+DiagnosticsView::kPageSize<_buffered->get().size())
+            out.index+=DiagnosticsView::kPageSize;
     } else if (c=='P'||c=='p') {
-        if (index>=5) out.index-=5;
+        if (index>=DiagnosticsView::kPageSize) out.index-=DiagnosticsView::kPageSize;
     } else if (c=='C'||c=='c') {
         if (_buffered && _view.confirmClear()) {
             _buffered->get().clear();
             out.index=0;
         }
+    } else if (c=='L'||c=='l') {
+        auto& probes = LatencyProbes::instance();
+        _view.renderLatency(probes, platform::now());
+        char k = readCharBlocking();
+        if (k=='R'||k=='r') probes.reset();
     } else if (c=='T'||c=='t') {
         SelfTestStatus st = selfTest();
         if (st == SelfTestStatus::Ok)
@@ -30,8 +30,31 @@ void DiagnosticsView::render(const DiagnosticsViewModel& model, size_t index) co
     _out.writeln(" minutes ago");
     if (model.history) {
         const auto& hist = *model.history;
-        for (size_t i = 0; i < 5 && index + i < hist.size(); ++i)
-            _out.writeln(hist[index + i].c_str());
+        char line[96];
+        for (size_t i = 0; i < kPageSize && index + i < hist.size(); ++i) {
+            hist.at(index + i).format(line, sizeof(line));
+            _out.writeln(line);
+        }
     }
-    _out.writeln("[N]ext [P]rev [C]lear [T]est [B]ack");
+    _out.writeln("[N]ext [P]rev [C]lear [T]est [L]atency [B]ack");
+}
+
+void DiagnosticsView::renderLatency(const LatencyProbes& probes, platform::TimeMs now) const {
+    char line[64];
+    _out.writeln("--- Latency (us) ---");
+#if !WINDVANE_LATENCY_PROBES
+    _out.writeln("Probes disabled (build with WINDVANE_LATENCY_PROBES=1)");
+#endif
+    snprintf(line, sizeof(line), "Loop rate: %.1f Hz", probes.loopRateHz(now));
+    _out.writeln(line);
+    snprintf(line, sizeof(line), "%-13s %7s %6s %6s %6s", "Stage", "count", "p50", "p99", "max");
+    _out.writeln(line);
+    for (size_t i = 0; i < static_cast<size_t>(Probe::Count); ++i) {
+        ProbeSummary s = probes.summary(static_cast<Probe>(i));
+        snprintf(line, sizeof(line), "%-13s %7lu %6lu %6lu %6lu", s.name,
+                 static_cast<unsigned long>(s.count), static_cast<unsigned long>(s.p50Us),
+                 static_cast<unsigned long>(s.p99Us), static_cast<unsigned long>(s.maxUs));
+        _out.writeln(line);
+    }
+    _out.writeln("[R]eset [B]ack");
 }
@@ -1,5 +1,6 @@
 #include "MenuPresenter.h"
 #include "WindVaneCompass.h"
+#include <Instrumentation/LatencyProbe.h>
 #include <cstdio>
 
 void MenuPresenter::renderStatusLine(const WindVaneStatus& st,
@@ -7,6 +8,7 @@ void MenuPresenter::renderStatusLine(const WindVaneStatus& st,
                                              const std::string& msg,
                                              MenuStatusLevel level,
                                              bool color) const {
+    WINDVANE_PROBE(StatusLine);
     char line[80];
     snprintf(line, sizeof(line),
              "\rDir:%6.1f\xC2\xB0 %-2s Status:%-10s Cal:%4lum", st.direction,
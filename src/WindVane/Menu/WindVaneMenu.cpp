@@ -8,6 +8,7 @@
 #include "WindVane/Calibration/CalibrationResult.h"
 #include "WindVane/Platform/IPlatform.h"
 #include "WindVane/Storage/StorageResult.h"
+#include "WindVane/Instrumentation/LatencyProbe.h"
 #include <cstdio>
 #include <limits>
 
@@ -33,12 +34,16 @@ WindVaneMenu::WindVaneMenu(const WindVaneMenuConfig& cfg)
 
 void WindVaneMenu::begin() {
   _state.stack.clear();
-  pushState(static_cast<State>(_settingsMgr.getMenuState()));
+  State restored = static_cast<State>(_settingsMgr.getMenuState());
+  // A calibration session does not survive a reboot
+  if (restored == State::Calibrate) restored = State::Main;
+  pushState(restored);
   showMainMenu();
   _display.begin(_vane);
 }
 
 void WindVaneMenu::update() {
+  WINDVANE_PROBE(MenuUpdate);
   if (_io.hasInput()) {
     char c = _io.readInput();
     _display.onInput();
@@ -47,19 +52,28 @@ void WindVaneMenu::update() {
     } else if (currentState() == State::LiveDisplay) {
       popState();
       showMainMenu();
+    } else if (currentState() == State::Calibrate) {
+      if (c == 'X' || c == 'x')
+        _vane.abortCalibration();
+      else
+        _vane.finishCalibration();
     }
   }
+  if (currentState() == State::Calibrate) updateCalibration();
   if (currentState() == State::LiveDisplay) {
     if (_display.updateLiveDisplay(_vane)) {
       popState();
       showMainMenu();
     }
   }
-  if (_display.checkTimeout() && currentState() != State::Main) {
+  // A running calibration expects no key presses, so it is exempt
+  if (_display.checkTimeout() && currentState() != State::Main &&
+      currentState() != State::Calibrate) {
     while (currentState() != State::Main) popState();
     showMainMenu();
   }
   _display.showStatusLine(_vane);
+  _settingsMgr.poll(_platform.millis());
 }
 
 void WindVaneMenu::showMainMenu() const {
@@ -88,23 +102,53 @@ void WindVaneMenu::handleMainInput(char c) {
 }
 
 
-MenuResult WindVaneMenu::runCalibration() {
+MenuResult WindVaneMenu::startCalibration() {
   MenuResult out;
   if (!_io.yesNoPrompt("Start calibration? (Y/N)")) {
     out.message = "Calibration cancelled";
     return out;
   }
-  CalibrationResult res = _vane.runCalibration();
-  if (res.success) {
-    _display.recordCalibration();
-    out.success = true;
-    out.message = "Calibration complete";
-  } else {
+  pushState(State::Calibrate);
+  CalibrationResult res = _vane.startCalibration(_platform.millis());
+  if (!res.success) {
+    popState();
     out.message = res.error;
+    return out;
   }
+  _calibrationShown = 0;
+  out.success = true;
+  out.message = "Calibrating - rotate the vane";
   return out;
 }
 
+void WindVaneMenu::updateCalibration() {
+  bool running = _vane.stepCalibration(_platform.millis());
+  CalibrationProgress p = _vane.getCalibrationProgress();
+  if (running) {
+    if (p.detected != _calibrationShown) {
+      char msg[48];
+      snprintf(msg, sizeof(msg), "Calibrating: %u/%u positions",
+               static_cast<unsigned>(p.detected),
+               static_cast<unsigned>(p.expected));
+      _display.setStatusMessage(msg, MenuStatusLevel::Normal,
+                                platform::TimeMs{30000});
+      _calibrationShown = p.detected;
+    }
+    return;
+  }
+
+  if (p.status == SessionStatus::Finished) {
+    _display.recordCalibration();
+    _diag.info("Calibration complete");
+    _display.setStatusMessage("Calibration complete", MenuStatusLevel::Normal);
+  } else {
+    _diag.warn("Calibration aborted");
+    _display.setStatusMessage("Calibration aborted", MenuStatusLevel::Warning);
+  }
+  popState();
+  showMainMenu();
+}
+
 void WindVaneMenu::handleDisplaySelection() {
   pushState(State::LiveDisplay);
   if (_vane.getCalibrationStatus() !=
@@ -114,16 +158,17 @@ void WindVaneMenu::handleDisplaySelection() {
 }
 
 void WindVaneMenu::handleCalibrateSelection() {
-  pushState(State::Calibrate);
-  MenuResult r = runCalibration();
+  MenuResult r = startCalibration();
   if (r.success) {
     _diag.info(r.message.c_str());
     _display.setStatusMessage(r.message.c_str(), MenuStatusLevel::Normal);
-  } else if (!r.message.empty()) {
+    _out.writeln("Calibrating - [X] abort, any other key to finish");
+    return;
+  }
+  if (!r.message.empty()) {
     _diag.warn(r.message.c_str());
     _display.setStatusMessage(r.message.c_str(), MenuStatusLevel::Error);
   }
-  popState();
   showMainMenu();
 }
 
@@ -166,28 +211,19 @@ void WindVaneMenu::showHelp() const {
 
 void WindVaneMenu::clearScreen() const { _out.clear(); }
 
+// Navigation only marks the menu state dirty; SettingsManager::poll writes
+// it once the menu has been idle and reports a failed write itself. No write
+// happens here, so there is nothing to roll back and transitions always
+// succeed.
 void WindVaneMenu::pushState(State s) {
   _state.stack.push_back(static_cast<PersistedMenuState>(s));
   _settingsMgr.setMenuState(static_cast<PersistedMenuState>(s));
-  StorageResult res = _settingsMgr.save();
-  if (!res.ok()) {
-    _diag.warn("Failed to persist menu state");
-    // Rollback the state change if save failed
-    if (!_state.stack.empty()) _state.stack.pop_back();
-  }
 }
 
 void WindVaneMenu::popState() {
   if (!_state.stack.empty()) {
-    PersistedMenuState oldState = _state.stack.back();
     _state.stack.pop_back();
     _settingsMgr.setMenuState(static_cast<PersistedMenuState>(currentState()));
-    StorageResult res = _settingsMgr.save();
-    if (!res.ok()) {
-      _diag.warn("Failed to persist menu state");
-      // Rollback the state change if save failed
-      _state.stack.push_back(oldState);
-    }
   }
 }
 
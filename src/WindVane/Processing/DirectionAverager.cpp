@@ -0,0 +1,79 @@
+#include "DirectionAverager.h"
+#include <algorithm>
+#include <cmath>
+
+DirectionAverager::DirectionAverager(platform::TimeMs window, size_t buckets)
+    : _buckets(std::clamp<size_t>(buckets, 1, kMaxBuckets)),
+      _bucketMs(std::max<uint32_t>(1, window.count() / static_cast<uint32_t>(_buckets))) {}
+
+void DirectionAverager::reset() {
+    _ring.fill(Bucket{});
+    _head = 0;
+    _started = false;
+    _sinTotal = 0;
+    _cosTotal = 0;
+    _count = 0;
+}
+
+void DirectionAverager::advance(platform::TimeMs now) {
+    if (!_started) {
+        _bucketStart = now;
+        _started = true;
+        return;
+    }
+    size_t steps = 0;
+    while ((now - _bucketStart).count() >= _bucketMs) {
+        if (steps++ == _buckets) {
+            // Idle for longer than the window: everything has expired
+            _bucketStart = now;
+            break;
+        }
+        _head = (_head + 1) % _buckets;
+        Bucket& old = _ring[_head];
+        _sinTotal -= old.sinSum;
+        _cosTotal -= old.cosSum;
+        _count -= old.count;
+        old = Bucket{};
+        _bucketStart += platform::TimeMs{_bucketMs};
+    }
+}
+
+void DirectionAverager::addStep(uint16_t step, platform::TimeMs now) {
+    advance(now);
+    const int16_t s = circular::sinStep(step);
+    const int16_t c = circular::cosStep(step);
+    Bucket& b = _ring[_head];
+    b.sinSum += s;
+    b.cosSum += c;
+    ++b.count;
+    _sinTotal += s;
+    _cosTotal += c;
+    ++_count;
+}
+
+void DirectionAverager::add(float degrees, platform::TimeMs now) {
+    // A NaN from a failed read would reach the integer cast below
+    if (!std::isfinite(degrees)) return;
+    float wrapped = std::fmod(degrees, 360.0f);
+    if (wrapped < 0.0f) wrapped += 360.0f;
+    addCentidegrees(static_cast<uint16_t>(wrapped * 100.0f + 0.5f), now);
+}
+
+void DirectionAverager::addCentidegrees(uint16_t centidegrees, platform::TimeMs now) {
+    addStep(circular::stepFromCentidegrees(centidegrees), now);
+}
+
+DirectionStats DirectionAverager::stats() const {
+    DirectionStats out;
+    out.samples = _count;
+    if (_count == 0) return out;
+    const double s = static_cast<double>(_sinTotal);
+    const double c = static_cast<double>(_cosTotal);
+    double mean = std::atan2(s, c) * 57.29577951308232;
+    if (mean < 0.0) mean += 360.0;
+    out.meanDeg = mean >= 360.0 ? 0.0f : static_cast<float>(mean);
+    const double r = std::sqrt(s * s + c * c) / (static_cast<double>(_count) * circular::kOne);
+    out.resultantLength = static_cast<float>(std::min(r, 1.0));
+    out.variance = 1.0f - out.resultantLength;
+    return out;
+}
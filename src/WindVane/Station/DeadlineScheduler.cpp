@@ -0,0 +1,44 @@
+#include "DeadlineScheduler.h"
+#include <utility>
+
+bool DeadlineScheduler::add(uint8_t id, uint32_t periodUs, uint32_t firstDueUs) {
+    if (_size == kCapacity) return false;
+    _heap[_size] = {firstDueUs, periodUs ? periodUs : 1, id};
+    siftUp(_size++);
+    return true;
+}
+
+int DeadlineScheduler::popDue(uint32_t nowUs) {
+    if (_size == 0 || before(nowUs, _heap[0].due)) return -1;
+    Entry& top = _heap[0];
+    const int id = top.id;
+    top.due += top.period;
+    if (!before(nowUs, top.due)) {
+        top.due = nowUs + top.period;
+        ++_overruns;
+    }
+    siftDown(0);
+    return id;
+}
+
+void DeadlineScheduler::siftUp(size_t i) {
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (!before(_heap[i].due, _heap[parent].due)) break;
+        std::swap(_heap[i], _heap[parent]);
+        i = parent;
+    }
+}
+
+void DeadlineScheduler::siftDown(size_t i) {
+    for (;;) {
+        size_t smallest = i;
+        const size_t left = 2 * i + 1;
+        const size_t right = left + 1;
+        if (left < _size && before(_heap[left].due, _heap[smallest].due)) smallest = left;
+        if (right < _size && before(_heap[right].due, _heap[smallest].due)) smallest = right;
+        if (smallest == i) return;
+        std::swap(_heap[i], _heap[smallest]);
+        i = smallest;
+    }
+}
@@ -0,0 +1,133 @@
+#include "WindVaneStation.h"
+
+#if !defined(ARDUINO)
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+namespace {
+
+// Upper bound on a worker's sleep so stop() is noticed promptly
+constexpr uint32_t kMaxIdleUs = 10000;
+// Shorter waits yield instead, since sleeps overshoot by tens of microseconds
+constexpr uint32_t kMinSleepUs = 200;
+
+} // namespace
+#endif
+
+WindVaneStation::WindVaneStation(IUserIO& io, IDiagnostics& diag)
+    : _io(io), _diag(diag) {
+  _slots.reserve(kMaxVanes);
+}
+
+WindVaneStation::~WindVaneStation() {
+#if !defined(ARDUINO)
+  stop();
+#endif
+}
+
+int WindVaneStation::addVane(const StationVaneConfig& cfg) {
+#if !defined(ARDUINO)
+  if (running()) return -1;
+#endif
+  if (_slots.size() == kMaxVanes) return -1;
+  auto slot = std::make_unique<Slot>();
+  WindVaneConfig vaneCfg{cfg.adc, WindVaneType::REED_SWITCH, cfg.method, &cfg.storage,
+                         _io, _diag, cfg.config};
+  vaneCfg.filter = cfg.filter;
+  vaneCfg.averager = cfg.averager;
+  slot->vane = std::make_unique<WindVane>(vaneCfg);
+  slot->periodUs = 1000000UL / (cfg.sampleRateHz ? cfg.sampleRateHz : 1);
+  const uint8_t id = static_cast<uint8_t>(_slots.size());
+  // Scheduled by the next poll(), which knows the current time; seeding
+  // with 0 would read as "in the future" once micros() passes 2^31
+  _slots.push_back(std::move(slot));
+  return id;
+}
+
+void WindVaneStation::sample(Slot& slot, uint32_t nowUs) {
+  slot.degrees.store(slot.vane->sample(platform::now()), std::memory_order_relaxed);
+  slot.timestampUs.store(nowUs, std::memory_order_relaxed);
+  slot.samples.fetch_add(1, std::memory_order_relaxed);
+}
+
+size_t WindVaneStation::poll(uint32_t nowUs) {
+  for (; _scheduled < _slots.size(); ++_scheduled)
+    _scheduler.add(static_cast<uint8_t>(_scheduled), _slots[_scheduled]->periodUs, nowUs);
+  size_t sampled = 0;
+  int id;
+  while ((id = _scheduler.popDue(nowUs)) >= 0) {
+    sample(*_slots[id], nowUs);
+    ++sampled;
+  }
+  return sampled;
+}
+
+std::optional<uint32_t> WindVaneStation::nextDeadlineUs() const {
+  if (_scheduler.empty()) return std::nullopt;
+  return _scheduler.nextDeadline();
+}
+
+StationReading WindVaneStation::reading(size_t index) const {
+  const Slot& slot = *_slots[index];
+  return {slot.degrees.load(std::memory_order_relaxed),
+          slot.timestampUs.load(std::memory_order_relaxed),
+          slot.samples.load(std::memory_order_relaxed)};
+}
+
+uint64_t WindVaneStation::totalSamples() const {
+  uint64_t total = 0;
+  for (const auto& slot : _slots) total += slot->samples.load(std::memory_order_relaxed);
+  return total;
+}
+
+uint32_t WindVaneStation::overruns() const {
+  uint32_t total = _scheduler.overruns();
+#if !defined(ARDUINO)
+  total += _workerOverruns.load(std::memory_order_relaxed);
+#endif
+  return total;
+}
+
+#if !defined(ARDUINO)
+
+bool WindVaneStation::start(size_t workers) {
+  if (running()) return true;
+  if (_slots.empty()) return false;
+  workers = std::clamp<size_t>(workers, 1, _slots.size());
+  _stop.store(false);
+  const uint32_t now = platform::nowUs();
+  for (size_t w = 0; w < workers; ++w) _workers.push_back(std::make_unique<Worker>());
+  for (size_t i = 0; i < _slots.size(); ++i)
+    _workers[i % workers]->scheduler.add(static_cast<uint8_t>(i), _slots[i]->periodUs, now);
+  for (auto& worker : _workers)
+    worker->thread = std::thread(&WindVaneStation::runWorker, this, std::ref(*worker));
+  return true;
+}
+
+void WindVaneStation::stop() {
+  if (!running()) return;
+  _stop.store(true);
+  for (auto& worker : _workers) {
+    worker->thread.join();
+    _workerOverruns.fetch_add(worker->scheduler.overruns(), std::memory_order_relaxed);
+  }
+  _workers.clear();
+}
+
+void WindVaneStation::runWorker(Worker& worker) {
+  while (!_stop.load(std::memory_order_relaxed)) {
+    uint32_t now = platform::nowUs();
+    int id;
+    while ((id = worker.scheduler.popDue(now)) >= 0) sample(*_slots[id], now);
+    now = platform::nowUs();
+    const uint32_t next = worker.scheduler.nextDeadline();
+    if (!DeadlineScheduler::before(now, next)) continue;
+    if (next - now < kMinSleepUs)
+      std::this_thread::yield();
+    else
+      std::this_thread::sleep_for(std::chrono::microseconds(std::min(next - now, kMaxIdleUs)));
+  }
+}
+
+#endif
@@ -0,0 +1,142 @@
+#include "Crc32.h"
+#include <array>
+
+#if !defined(ARDUINO) && (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define WINDVANE_CRC_X86 1
+#include <nmmintrin.h>
+#elif !defined(ARDUINO) && defined(__aarch64__) && defined(__linux__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define WINDVANE_CRC_ARM 1
+#include <arm_acle.h>
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+
+namespace {
+
+constexpr uint32_t polynomial(CrcKind kind) {
+    return kind == CrcKind::Ieee ? 0xEDB88320u : 0x82F63B78u;
+}
+
+#if WINDVANE_CRC_TABLES
+using SliceTables = std::array<std::array<uint32_t, 256>, 8>;
+
+constexpr SliceTables makeTables(uint32_t poly) {
+    SliceTables t{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        for (int j = 0; j < 8; ++j)
+            c = (c & 1) ? (c >> 1) ^ poly : c >> 1;
+        t[0][i] = c;
+    }
+    for (size_t s = 1; s < 8; ++s)
+        for (size_t i = 0; i < 256; ++i)
+            t[s][i] = (t[s - 1][i] >> 8) ^ t[0][t[s - 1][i] & 0xFF];
+    return t;
+}
+
+constexpr SliceTables kIeeeTables = makeTables(polynomial(CrcKind::Ieee));
+constexpr SliceTables kCastagnoliTables = makeTables(polynomial(CrcKind::Castagnoli));
+
+uint32_t sliceBy8(const SliceTables& t, uint32_t crc, const unsigned char* p, size_t len) {
+    while (len >= 8) {
+        const uint32_t lo = crc ^ (uint32_t(p[0]) | uint32_t(p[1]) << 8 |
+                                   uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24);
+        const uint32_t hi = uint32_t(p[4]) | uint32_t(p[5]) << 8 |
+                            uint32_t(p[6]) << 16 | uint32_t(p[7]) << 24;
+        crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^
+              t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+              t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^
+              t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+        p += 8;
+        len -= 8;
+    }
+    while (len--)
+        crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xFF];
+    return crc;
+}
+#endif
+
+#if WINDVANE_CRC_X86
+__attribute__((target("sse4.2")))
+uint32_t castagnoliHardware(uint32_t crc, const unsigned char* p, size_t len) {
+#if defined(__x86_64__)
+    uint64_t c = crc;
+    for (; len >= 8; p += 8, len -= 8) {
+        uint64_t v;
+        __builtin_memcpy(&v, p, 8);
+        c = _mm_crc32_u64(c, v);
+    }
+    crc = static_cast<uint32_t>(c);
+#endif
+    for (; len >= 4; p += 4, len -= 4) {
+        uint32_t v;
+        __builtin_memcpy(&v, p, 4);
+        crc = _mm_crc32_u32(crc, v);
+    }
+    while (len--)
+        crc = _mm_crc32_u8(crc, *p++);
+    return crc;
+}
+
+bool detectHardware() { return __builtin_cpu_supports("sse4.2"); }
+#elif WINDVANE_CRC_ARM
+__attribute__((target("+crc")))
+uint32_t castagnoliHardware(uint32_t crc, const unsigned char* p, size_t len) {
+    for (; len >= 8; p += 8, len -= 8) {
+        uint64_t v;
+        __builtin_memcpy(&v, p, 8);
+        crc = __crc32cd(crc, v);
+    }
+    while (len--)
+        crc = __crc32cb(crc, *p++);
+    return crc;
+}
+
+bool detectHardware() { return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0; }
+#endif
+
+} // namespace
+
+uint32_t Crc32::updatePortable(CrcKind kind, uint32_t state,
+                               const unsigned char* data, size_t len) {
+#if WINDVANE_CRC_TABLES
+    return sliceBy8(kind == CrcKind::Ieee ? kIeeeTables : kCastagnoliTables,
+                    state, data, len);
+#else
+    const uint32_t poly = polynomial(kind);
+    while (len--) {
+        state ^= *data++;
+        for (int j = 0; j < 8; ++j)
+            state = (state & 1) ? (state >> 1) ^ poly : state >> 1;
+    }
+    return state;
+#endif
+}
+
+bool Crc32::hardwareAccelerated() {
+#if WINDVANE_CRC_X86 || WINDVANE_CRC_ARM
+    static const bool available = detectHardware();
+    return available;
+#else
+    return false;
+#endif
+}
+
+void Crc32::update(const void* data, size_t len) {
+    const auto* p = static_cast<const unsigned char*>(data);
+#if WINDVANE_CRC_X86 || WINDVANE_CRC_ARM
+    if (_kind == CrcKind::Castagnoli && hardwareAccelerated()) {
+        _state = castagnoliHardware(_state, p, len);
+        return;
+    }
+#endif
+    _state = updatePortable(_kind, _state, p, len);
+}
+
+uint32_t Crc32::compute(CrcKind kind, const void* data, size_t len) {
+    Crc32 crc(kind);
+    crc.update(data, len);
+    return crc.value();
+}
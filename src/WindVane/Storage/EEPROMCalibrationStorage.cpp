@@ -1,52 +1,141 @@
 #include "EEPROMCalibrationStorage.h"
+#include <Instrumentation/LatencyProbe.h>
 #include <Platform/IPlatform.h>
-#include <PlatformFactory.h>
+#include <Storage/EepromIO.h>
+
+namespace {
+constexpr size_t kFullSlotSize = sizeof(CalibrationStorageHeader) +
+                                 EEPROMCalibrationStorage::kMaxClusters * sizeof(ClusterData);
+
+size_t regionBytes(size_t start, size_t eepromSize, size_t regionSize) {
+    if (regionSize > 0)
+        return regionSize;
+    return eepromSize > start ? eepromSize - start : 0;
+}
+
+int deriveSlotCount(size_t region, int slotCount) {
+    if (slotCount > 0)
+        return slotCount;
+    const size_t fit = region / kFullSlotSize;
+    return fit > 0 ? static_cast<int>(fit) : 1;
+}
+} // namespace
 
 EEPROMCalibrationStorage::EEPROMCalibrationStorage(IPlatform& platform,
                                                     size_t startAddress,
-                                                    size_t eepromSize)
+                                                    size_t eepromSize,
+                                                    size_t regionSize,
+                                                    int slotCount)
     : _startAddress(startAddress), _eepromSize(eepromSize),
-      _slotCount(4), _slotSize(eepromSize / 4), _platform(platform) {}
+      _regionSize(regionBytes(startAddress, eepromSize, regionSize)),
+      _slotCount(deriveSlotCount(_regionSize, slotCount)),
+      _slotSize(_regionSize / _slotCount),
+      _platform(platform), _slots(static_cast<size_t>(_slotCount)) {
+    if (startAddress >= eepromSize || _regionSize > eepromSize - startAddress)
+        _layout = {StorageStatus::InvalidFormat, "calibration region beyond EEPROM"};
+    else if (_slotSize < sizeof(CalibrationStorageHeader) + sizeof(ClusterData))
+        _layout = {StorageStatus::InvalidFormat, "calibration slot too small"};
+}
+
+size_t EEPROMCalibrationStorage::maxClusters() const {
+    if (_slotSize < sizeof(CalibrationStorageHeader))
+        return 0;
+    const size_t fit = (_slotSize - sizeof(CalibrationStorageHeader)) / sizeof(ClusterData);
+    return fit < kMaxClusters ? fit : kMaxClusters;
+}
+
+// Reads every slot header once, on first use rather than at construction
+// so a static instance never touches EEPROM before the platform is up.
+void EEPROMCalibrationStorage::loadDirectory() {
+    if (_directoryLoaded || !platform_factory::has_eeprom())
+        return;
+    platform_factory::eeprom_begin(_eepromSize);
+    bool anySequenced = false;
+    uint16_t newest = 0;
+    for (int i = 0; i < _slotCount; ++i) {
+        CalibrationStorageHeader hdr{};
+        platform_factory::eeprom_read_bytes(slotAddr(i), &hdr, sizeof(CalibrationStorageHeader));
+        SlotEntry& e = _slots[static_cast<size_t>(i)];
+        e.valid = hdr.version != 0 && hdr.version != 0xFFFF &&
+                  hdr.count > 0 && hdr.count <= kMaxClusters;
+        e.sequenced = e.valid && (hdr.version & kSequenceVersionFlag);
+        e.sequence = hdr.sequence;
+        e.timestamp = hdr.timestamp;
+        if (e.sequenced && (!anySequenced || static_cast<int16_t>(e.sequence - newest) > 0)) {
+            newest = e.sequence;
+            anySequenced = true;
+        }
+    }
+    platform_factory::eeprom_end();
+    _nextSequence = anySequenced ? static_cast<uint16_t>(newest + 1) : 0;
+    _directoryLoaded = true;
+}
+
+bool EEPROMCalibrationStorage::newer(const SlotEntry& a, const SlotEntry& b) {
+    if (a.valid != b.valid) return a.valid;
+    if (a.sequenced != b.sequenced) return a.sequenced;
+    if (a.sequenced) return static_cast<int16_t>(a.sequence - b.sequence) > 0;
+    return a.timestamp > b.timestamp;
+}
+
+int EEPROMCalibrationStorage::findLatestSlot() {
+    loadDirectory();
+    int latest = -1;
+    for (int i = 0; i < _slotCount; ++i) {
+        const SlotEntry& e = _slots[static_cast<size_t>(i)];
+        if (e.valid && (latest < 0 || newer(e, _slots[static_cast<size_t>(latest)])))
+            latest = i;
+    }
+    return latest;
+}
 
 StorageResult EEPROMCalibrationStorage::save(const std::vector<ClusterData>& clusters, int version) {
+    WINDVANE_PROBE(StorageSave);
     if (!platform_factory::has_eeprom()) {
         (void)clusters;
         (void)version;
         return {StorageStatus::IoError, "no eeprom"};
     }
+    if (!_layout.ok())
+        return _layout;
     
-    // Check for overflow before casting to uint16_t
-    if (clusters.size() > UINT16_MAX) {
-        return {StorageStatus::InvalidFormat, "too many clusters"};
+    if (clusters.empty() || clusters.size() > kMaxClusters) {
+        return {StorageStatus::InvalidFormat, "cluster count"};
     }
     
-    int latest = findLatestSlot();
-    int slot = latest < 0 ? 0 : (latest + 1) % _slotCount;
-    size_t addr = slotAddr(slot);
-    
-    // Validate that we have enough space
+    // Validate that one slot can hold the calibration
     size_t requiredSpace = sizeof(CalibrationStorageHeader) + 
                           clusters.size() * sizeof(ClusterData);
-    if (addr + requiredSpace > _eepromSize) {
-        return {StorageStatus::InvalidFormat, "insufficient EEPROM space"};
+    if (requiredSpace > _slotSize) {
+        return {StorageStatus::InvalidFormat, "calibration larger than slot"};
     }
     
+    int latest = findLatestSlot();
+    int slot = latest < 0 ? 0 : (latest + 1) % _slotCount;
+    size_t addr = slotAddr(slot);
+    
     platform_factory::eeprom_begin(_eepromSize);
     _schemaVersion = version;
     CalibrationStorageHeader hdr{};
-    hdr.version = static_cast<uint16_t>(version);
+    hdr.version = static_cast<uint16_t>(storedVersion(static_cast<uint16_t>(version)) |
+                                        kSequenceVersionFlag);
+    hdr.sequence = _nextSequence;
     hdr.timestamp = platform::toEmbedded(_platform.millis());
     _lastTimestamp = hdr.timestamp;
     hdr.count = static_cast<uint16_t>(clusters.size());
-    hdr.crc = crc32(clusters);
+    // Payload first as one block with the CRC folded in alongside; the
+    // header lands before the commit, so the slot is never half valid.
+    const size_t payload = clusters.size() * sizeof(ClusterData);
+    Crc32 crc(kStorageCrcKind);
+    platform_factory::eeprom_write_bytes(addr + sizeof(CalibrationStorageHeader),
+                                         clusters.data(), payload);
+    crc.update(clusters.data(), payload);
+    hdr.crc = crc.value();
     platform_factory::eeprom_write_bytes(addr, &hdr, sizeof(CalibrationStorageHeader));
-    addr += sizeof(CalibrationStorageHeader);
-    for (const auto& c : clusters) {
-        platform_factory::eeprom_write_bytes(addr, &c, sizeof(ClusterData));
-        addr += sizeof(ClusterData);
-    }
     platform_factory::eeprom_commit();
     platform_factory::eeprom_end();
+    _slots[static_cast<size_t>(slot)] = {true, true, hdr.sequence, hdr.timestamp};
+    ++_nextSequence;
     return {};
 }
 
@@ -56,35 +145,55 @@ StorageResult EEPROMCalibrationStorage::load(std::vector<ClusterData>& clusters,
         (void)version;
         return {StorageStatus::IoError, "no eeprom"};
     }
-    int slot = findLatestSlot();
-    if (slot < 0)
-        return {StorageStatus::NotFound, "slot"};
-    size_t addr = slotAddr(slot);
-    platform_factory::eeprom_begin(_eepromSize);
-    CalibrationStorageHeader hdr{};
-    platform_factory::eeprom_read_bytes(addr, &hdr, sizeof(CalibrationStorageHeader));
-    addr += sizeof(CalibrationStorageHeader);
-    version = hdr.version;
-    _schemaVersion = hdr.version;
-    _lastTimestamp = hdr.timestamp;
-    uint16_t count = hdr.count;
-    if (count == 0 || count > 64) {
+    if (!_layout.ok())
+        return _layout;
+    loadDirectory();
+    // Newest first; a slot torn by a power cut falls back to the one before
+    std::vector<bool> tried(static_cast<size_t>(_slotCount), false);
+    StorageResult res{StorageStatus::NotFound, "slot"};
+    for (int attempt = 0; attempt < _slotCount; ++attempt) {
+        int slot = -1;
+        for (int i = 0; i < _slotCount; ++i) {
+            const SlotEntry& e = _slots[static_cast<size_t>(i)];
+            if (!tried[static_cast<size_t>(i)] && e.valid &&
+                (slot < 0 || newer(e, _slots[static_cast<size_t>(slot)])))
+                slot = i;
+        }
+        if (slot < 0)
+            break;
+        tried[static_cast<size_t>(slot)] = true;
+
+        size_t addr = slotAddr(slot);
+        platform_factory::eeprom_begin(_eepromSize);
+        CalibrationStorageHeader hdr{};
+        platform_factory::eeprom_read_bytes(addr, &hdr, sizeof(CalibrationStorageHeader));
+        addr += sizeof(CalibrationStorageHeader);
+        const uint16_t count = hdr.count;
+        // A bad slot leaves the directory so the next save reuses it
+        // rather than overwriting the copy we fall back to
+        if (sizeof(CalibrationStorageHeader) + count * sizeof(ClusterData) > _slotSize) {
+            platform_factory::eeprom_end();
+            _slots[static_cast<size_t>(slot)].valid = false;
+            res = {StorageStatus::InvalidFormat, "count"};
+            continue;
+        }
+        clusters.resize(count);
+        Crc32 crc(crcKindForVersion(hdr.version));
+        platform_factory::eeprom_read_bytes(addr, clusters.data(), count * sizeof(ClusterData));
+        crc.update(clusters.data(), count * sizeof(ClusterData));
         platform_factory::eeprom_end();
-        return {StorageStatus::InvalidFormat, "count"};
-    }
-    clusters.resize(count);
-    for (uint16_t i = 0; i < count; ++i) {
-        ClusterData c{};
-        platform_factory::eeprom_read_bytes(addr, &c, sizeof(ClusterData));
-        addr += sizeof(ClusterData);
-        clusters[i] = c;
-    }
-    platform_factory::eeprom_end();
-    uint32_t crc = crc32(clusters);
-    if (crc != hdr.crc) {
-        return {StorageStatus::CorruptData, "crc"};
+        if (crc.value() != hdr.crc) {
+            _slots[static_cast<size_t>(slot)].valid = false;
+            res = {StorageStatus::CorruptData, "crc"};
+            continue;
+        }
+        version = calibrationSchema(hdr.version);
+        _schemaVersion = version;
+        _lastTimestamp = hdr.timestamp;
+        return {};
     }
-    return {};
+    clusters.clear();
+    return res;
 }
 
 StorageResult EEPROMCalibrationStorage::clear() {
@@ -93,13 +202,17 @@ StorageResult EEPROMCalibrationStorage::clear() {
         (void)hdr;
         return {StorageStatus::IoError, "no eeprom"};
     }
+    if (!_layout.ok())
+        return _layout;
     platform_factory::eeprom_begin(_eepromSize);
     for (int i = 0; i < _slotCount; ++i) {
         size_t addr = slotAddr(i);
         platform_factory::eeprom_write_bytes(addr, &hdr, sizeof(CalibrationStorageHeader));
+        _slots[static_cast<size_t>(i)] = SlotEntry{};
     }
     platform_factory::eeprom_commit();
     platform_factory::eeprom_end();
+    _directoryLoaded = true;
     return {};
 }
 
@@ -108,22 +221,19 @@ StorageResult EEPROMCalibrationStorage::writeBlob(const std::vector<unsigned cha
         (void)data;
         return {StorageStatus::IoError, "no eeprom"};
     }
-    
-    // Improved size validation with clearer error message
-    if (_startAddress >= _eepromSize) {
-        return {StorageStatus::InvalidFormat, "start address beyond EEPROM"};
-    }
-    
-    size_t availableSpace = _eepromSize - _startAddress;
-    if (data.size() > availableSpace) {
-        return {StorageStatus::InvalidFormat, "data too large for EEPROM"};
+    if (!_layout.ok())
+        return _layout;
+    // Stay inside the calibration region; settings may follow it
+    if (data.size() > _regionSize) {
+        return {StorageStatus::InvalidFormat, "data too large for calibration region"};
     }
     
     platform_factory::eeprom_begin(_eepromSize);
-    for (size_t i = 0; i < data.size(); ++i)
-        platform_factory::eeprom_write_byte(_startAddress + i, data[i]);
+    platform_factory::eeprom_write_bytes(_startAddress, data.data(), data.size());
     platform_factory::eeprom_commit();
     platform_factory::eeprom_end();
+    // The blob may have replaced any slot; rescan on next use
+    _directoryLoaded = false;
     return {};
 }
 
@@ -132,32 +242,11 @@ StorageResult EEPROMCalibrationStorage::readBlob(std::vector<unsigned char>& dat
         (void)data;
         return {StorageStatus::IoError, "no eeprom"};
     }
+    if (!_layout.ok())
+        return _layout;
     platform_factory::eeprom_begin(_eepromSize);
-    data.resize(_eepromSize - _startAddress);
-    for (size_t i = 0; i < data.size(); ++i)
-        data[i] = platform_factory::eeprom_read_byte(_startAddress + i);
+    data.resize(_regionSize);
+    platform_factory::eeprom_read_bytes(_startAddress, data.data(), data.size());
     platform_factory::eeprom_end();
     return {};
 }
-
-int EEPROMCalibrationStorage::findLatestSlot() const {
-    if (!platform_factory::has_eeprom()) {
-        return -1;
-    }
-    platform_factory::eeprom_begin(_eepromSize);
-    int latest = -1;
-    uint32_t latestTs = 0;
-    for (int i = 0; i < _slotCount; ++i) {
-        size_t addr = slotAddr(i);
-        CalibrationStorageHeader hdr{};
-        platform_factory::eeprom_read_bytes(addr, &hdr, sizeof(CalibrationStorageHeader));
-        if (hdr.version != 0 && hdr.count <= 64) {
-            if (hdr.timestamp >= latestTs) {
-                latestTs = hdr.timestamp;
-                latest = i;
-            }
-        }
-    }
-    platform_factory::eeprom_end();
-    return latest;
-}
@@ -1,10 +1,12 @@
 #include "EEPROMSettingsStorage.h"
-#include <PlatformFactory.h>
+#include <Instrumentation/LatencyProbe.h>
+#include <Storage/EepromIO.h>
 
 EEPROMSettingsStorage::EEPROMSettingsStorage(size_t start, size_t eepromSize)
     : _start(start), _size(eepromSize) {}
 
 StorageResult EEPROMSettingsStorage::save(const SettingsData& data) {
+    WINDVANE_PROBE(StorageSave);
     if (!platform_factory::has_eeprom()) {
         (void)data;
         return {StorageStatus::IoError, "no eeprom"};
@@ -12,7 +14,7 @@ StorageResult EEPROMSettingsStorage::save(const SettingsData& data) {
     platform_factory::eeprom_begin(_size);
     size_t addr = _start;
     SettingsStorageHeader hdr{};
-    hdr.version = 1;
+    hdr.version = storedVersion(kSettingsVersion);
     hdr.crc = SettingsStorageBase::crc32(reinterpret_cast<const unsigned char*>(&data), sizeof(data));
     platform_factory::eeprom_write_bytes(addr, &hdr, sizeof(SettingsStorageHeader));
     addr += sizeof(SettingsStorageHeader);
@@ -20,7 +22,7 @@ StorageResult EEPROMSettingsStorage::save(const SettingsData& data) {
     addr += sizeof(SettingsData);
     platform_factory::eeprom_commit();
     platform_factory::eeprom_end();
-    _schemaVersion = hdr.version;
+    _schemaVersion = kSettingsVersion;
     return {};
 }
 
@@ -37,9 +39,10 @@ StorageResult EEPROMSettingsStorage::load(SettingsData& data) {
     platform_factory::eeprom_read_bytes(addr, &data, sizeof(SettingsData));
     addr += sizeof(SettingsData);
     platform_factory::eeprom_end();
-    uint32_t crc = SettingsStorageBase::crc32(reinterpret_cast<const unsigned char*>(&data), sizeof(data));
+    uint32_t crc = SettingsStorageBase::crc32(reinterpret_cast<const unsigned char*>(&data), sizeof(data),
+                                              crcKindForVersion(hdr.version));
     if (crc != hdr.crc)
         return {StorageStatus::CorruptData, "crc"};
-    _schemaVersion = hdr.version;
+    _schemaVersion = schemaVersion(hdr.version);
     return {};
 }
@@ -0,0 +1,142 @@
+#include "EepromIO.h"
+#include <cstring>
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <EEPROM.h>
+#else
+#include "EmulatedEeprom.h"
+#endif
+
+namespace platform_factory {
+
+// Block EEPROM I/O. Writes compare against the current contents in
+// kEepromChunk pieces and copy only the runs that differ; a commit is issued
+// only when something changed since the last one.
+namespace {
+
+constexpr size_t kEepromChunk = 32;
+EepromStats gEepromStats{};
+bool gEepromChanged = false;
+#ifndef ARDUINO
+EmulatedEeprom* gEmulated = nullptr;
+#endif
+
+void rawRead(size_t addr, uint8_t* data, size_t len) {
+#if defined(ARDUINO_ARCH_ESP32)
+    EEPROM.readBytes(addr, data, len);
+#elif defined(ARDUINO)
+    for (size_t i = 0; i < len; ++i) data[i] = EEPROM.read(addr + i);
+#else
+    if (gEmulated)
+        gEmulated->read(addr, data, len);
+    else
+        std::memset(data, 0, len);
+#endif
+}
+
+void rawWrite(size_t addr, const uint8_t* data, size_t len) {
+#if defined(ARDUINO_ARCH_ESP32)
+    EEPROM.writeBytes(addr, data, len);
+#elif defined(ARDUINO)
+    for (size_t i = 0; i < len; ++i) EEPROM.write(addr + i, data[i]);
+#else
+    if (gEmulated)
+        gEmulated->write(addr, data, len);
+#endif
+}
+
+} // namespace
+
+void eeprom_begin(size_t size) {
+#ifdef ARDUINO
+    EEPROM.begin(size);
+#else
+    if (gEmulated)
+        gEmulated->begin(size);
+#endif
+}
+
+void eeprom_commit() {
+    if (!gEepromChanged) {
+        ++gEepromStats.commitsSkipped;
+        return;
+    }
+#ifdef ARDUINO
+    EEPROM.commit();
+#else
+    if (gEmulated)
+        gEmulated->commit();
+#endif
+    gEepromChanged = false;
+    ++gEepromStats.commits;
+}
+
+void eeprom_end() {
+#ifdef ARDUINO
+    EEPROM.end();
+#else
+    if (gEmulated)
+        gEmulated->end();
+#endif
+}
+
+void eeprom_write_bytes(size_t addr, const void* data, size_t len) {
+    const uint8_t* src = static_cast<const uint8_t*>(data);
+    uint8_t current[kEepromChunk];
+    ++gEepromStats.writes;
+    for (size_t off = 0; off < len; off += kEepromChunk) {
+        const size_t n = len - off < kEepromChunk ? len - off : kEepromChunk;
+        rawRead(addr + off, current, n);
+        size_t i = 0;
+        while (i < n) {
+            if (current[i] == src[off + i]) {
+                ++i;
+                continue;
+            }
+            size_t runEnd = i + 1;
+            while (runEnd < n && current[runEnd] != src[off + runEnd]) ++runEnd;
+            rawWrite(addr + off + i, src + off + i, runEnd - i);
+            gEepromStats.bytesWritten += static_cast<uint32_t>(runEnd - i);
+            gEepromChanged = true;
+            i = runEnd;
+        }
+    }
+    gEepromStats.bytesRequested += static_cast<uint32_t>(len);
+}
+
+void eeprom_read_bytes(size_t addr, void* data, size_t len) {
+    rawRead(addr, static_cast<uint8_t*>(data), len);
+    ++gEepromStats.reads;
+    gEepromStats.bytesRead += static_cast<uint32_t>(len);
+}
+
+uint8_t eeprom_read_byte(size_t addr) {
+    uint8_t value;
+    eeprom_read_bytes(addr, &value, 1);
+    return value;
+}
+
+void eeprom_write_byte(size_t addr, uint8_t value) {
+    eeprom_write_bytes(addr, &value, 1);
+}
+
+EepromStats eeprom_stats() { return gEepromStats; }
+
+void eeprom_reset_stats() { gEepromStats = EepromStats{}; }
+
+bool has_eeprom() {
+#ifdef ARDUINO
+    return true;
+#else
+    return gEmulated != nullptr && gEmulated->ok();
+#endif
+}
+
+#ifndef ARDUINO
+void use_emulated_eeprom(EmulatedEeprom* eeprom) {
+    gEmulated = eeprom;
+    gEepromChanged = false;
+}
+#endif
+
+} // namespace platform_factory
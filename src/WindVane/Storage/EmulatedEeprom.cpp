@@ -0,0 +1,103 @@
+#include "EmulatedEeprom.h"
+
+#if !defined(ARDUINO)
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+EmulatedEeprom::EmulatedEeprom(const std::string& path, size_t capacity)
+    : _path(path), _capacity(capacity),
+      _sectorErases((capacity + kSectorSize - 1) / kSectorSize, 0) {
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+        return;
+    struct stat st{};
+    const bool fresh = ::fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) < capacity;
+    if (fresh && ::ftruncate(fd, static_cast<off_t>(capacity)) != 0) {
+        ::close(fd);
+        return;
+    }
+    void* p = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED)
+        return;
+    _flash = static_cast<uint8_t*>(p);
+    // New flash reads as erased
+    if (fresh)
+        std::memset(_flash + st.st_size, 0xFF, capacity - static_cast<size_t>(st.st_size));
+}
+
+EmulatedEeprom::~EmulatedEeprom() {
+    if (_flash) {
+        ::msync(_flash, _capacity, MS_SYNC);
+        ::munmap(_flash, _capacity);
+    }
+}
+
+bool EmulatedEeprom::begin(size_t size) {
+    if (!_flash || size == 0 || size > _capacity)
+        return false;
+    if (_cache.size() == size)
+        return true;
+    _cache.assign(_flash, _flash + size);
+    _dirty = false;
+    return true;
+}
+
+void EmulatedEeprom::read(size_t addr, void* data, size_t len) const {
+    if (addr + len > _cache.size()) {
+        std::memset(data, 0, len);
+        return;
+    }
+    std::memcpy(data, _cache.data() + addr, len);
+}
+
+void EmulatedEeprom::write(size_t addr, const void* data, size_t len) {
+    if (addr + len > _cache.size())
+        return;
+    std::memcpy(_cache.data() + addr, data, len);
+    _dirty = true;
+}
+
+bool EmulatedEeprom::commit() {
+    if (_cache.empty())
+        return false;
+    if (!_dirty)
+        return true;
+    const size_t sectors = (_cache.size() + kSectorSize - 1) / kSectorSize;
+    for (size_t s = 0; s < sectors; ++s) {
+        const size_t base = s * kSectorSize;
+        const size_t n = _capacity - base < kSectorSize ? _capacity - base : kSectorSize;
+        // Erase the whole sector, then program the cached bytes and restore
+        // the tail that lies beyond the cache.
+        std::vector<uint8_t> keep(_flash + base, _flash + base + n);
+        std::memset(_flash + base, 0xFF, n);
+        for (size_t i = 0; i < n; ++i)
+            _flash[base + i] = base + i < _cache.size() ? _cache[base + i] : keep[i];
+        ++_sectorErases[s];
+        ++_erases;
+    }
+    ++_commits;
+    _dirty = false;
+    return true;
+}
+
+void EmulatedEeprom::end() {
+    commit();
+    _cache.clear();
+    _cache.shrink_to_fit();
+}
+
+uint32_t EmulatedEeprom::sectorErases(size_t sector) const {
+    return sector < _sectorErases.size() ? _sectorErases[sector] : 0;
+}
+
+void EmulatedEeprom::resetCounters() {
+    _commits = 0;
+    _erases = 0;
+    for (auto& e : _sectorErases) e = 0;
+}
+
+#endif
@@ -1,4 +1,5 @@
 #include "FileCalibrationStorage.h"
+#include <Instrumentation/LatencyProbe.h>
 #include <filesystem>
 #include <fstream>
 #include <ctime>
@@ -9,6 +10,7 @@ FileCalibrationStorage::FileCalibrationStorage(const std::string& path)
     : _path(path) {}
 
 StorageResult FileCalibrationStorage::save(const std::vector<ClusterData>& clusters, int version) {
+    WINDVANE_PROBE(StorageSave);
     backupExisting();
     std::ofstream ofs(_path, std::ios::binary);
     if (!ofs)
@@ -22,7 +24,7 @@ StorageResult FileCalibrationStorage::save(const std::vector<ClusterData>& clust
     _lastTimestamp = static_cast<uint32_t>(std::time(nullptr));
     _schemaVersion = version;
     CalibrationStorageHeader hdr{};
-    hdr.version = static_cast<uint16_t>(version);
+    hdr.version = storedVersion(static_cast<uint16_t>(version));
     hdr.timestamp = _lastTimestamp;
     hdr.count = static_cast<uint16_t>(clusters.size());
     hdr.crc = crc32(clusters);
@@ -43,8 +45,8 @@ StorageResult FileCalibrationStorage::load(std::vector<ClusterData>& clusters, i
     ifs.read(reinterpret_cast<char*>(&hdr), sizeof(hdr));
     if (!ifs)
         return {StorageStatus::IoError, "header"};
-    version = hdr.version;
-    _schemaVersion = hdr.version;
+    version = schemaVersion(hdr.version);
+    _schemaVersion = version;
     _lastTimestamp = hdr.timestamp;
     
     // Validate count to prevent buffer overflow
@@ -56,7 +58,7 @@ StorageResult FileCalibrationStorage::load(std::vector<ClusterData>& clusters, i
     ifs.read(reinterpret_cast<char*>(clusters.data()), hdr.count * sizeof(ClusterData));
     if (!ifs)
         return {StorageStatus::IoError, "data"};
-    uint32_t crc = crc32(clusters);
+    uint32_t crc = crc32(clusters, crcKindForVersion(hdr.version));
     if (crc != hdr.crc)
         return {StorageStatus::CorruptData, "crc"};
     return {};
@@ -1,4 +1,5 @@
 #include "FileSettingsStorage.h"
+#include <Instrumentation/LatencyProbe.h>
 #include <fstream>
 #include <cstdint>
 
@@ -6,17 +7,18 @@ FileSettingsStorage::FileSettingsStorage(const std::string& path)
     : _path(path) {}
 
 StorageResult FileSettingsStorage::save(const SettingsData& data) {
+    WINDVANE_PROBE(StorageSave);
     std::ofstream ofs(_path, std::ios::binary);
     if (!ofs)
         return {StorageStatus::IoError, "open"};
     SettingsStorageHeader hdr{};
-    hdr.version = 1;
+    hdr.version = storedVersion(kSettingsVersion);
     hdr.crc = SettingsStorageBase::crc32(reinterpret_cast<const unsigned char*>(&data), sizeof(data));
     ofs.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
     ofs.write(reinterpret_cast<const char*>(&data), sizeof(data));
     if (!ofs)
         return {StorageStatus::IoError, "write"};
-    _schemaVersion = hdr.version;
+    _schemaVersion = kSettingsVersion;
     return {};
 }
 
@@ -31,9 +33,10 @@ StorageResult FileSettingsStorage::load(SettingsData& data) {
     ifs.read(reinterpret_cast<char*>(&data), sizeof(data));
     if (!ifs)
         return {StorageStatus::IoError, "data"};
-    uint32_t crc = SettingsStorageBase::crc32(reinterpret_cast<const unsigned char*>(&data), sizeof(data));
+    uint32_t crc = SettingsStorageBase::crc32(reinterpret_cast<const unsigned char*>(&data), sizeof(data),
+                                              crcKindForVersion(hdr.version));
     if (crc != hdr.crc)
         return {StorageStatus::CorruptData, "crc"};
-    _schemaVersion = hdr.version;
+    _schemaVersion = schemaVersion(hdr.version);
     return {};
 }
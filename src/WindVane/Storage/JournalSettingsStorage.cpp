@@ -0,0 +1,223 @@
+#include "JournalSettingsStorage.h"
+#include "EEPROMSettingsStorage.h"
+#include <Instrumentation/LatencyProbe.h>
+#include <Storage/EepromIO.h>
+#include <cstring>
+
+namespace {
+using Field = JournalSettingsStorage::Field;
+
+uint32_t floatBits(float v) {
+    uint32_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+float bitsFloat(uint32_t bits) {
+    float v;
+    std::memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+bool validField(uint8_t f) {
+    return f >= static_cast<uint8_t>(Field::SpinThreshold) &&
+           f < static_cast<uint8_t>(Field::Count);
+}
+
+// Never past the end of EEPROM, whatever the caller reserved
+size_t regionBytes(size_t start, size_t eepromSize, size_t regionSize) {
+    const size_t available = eepromSize > start ? eepromSize - start : 0;
+    return regionSize > 0 && regionSize < available ? regionSize : available;
+}
+} // namespace
+
+JournalSettingsStorage::JournalSettingsStorage(size_t start, size_t eepromSize, size_t regionSize)
+    : _start(start), _size(eepromSize),
+      _halfRecords(regionBytes(start, eepromSize, regionSize) / sizeof(Record) / 2) {}
+
+uint8_t JournalSettingsStorage::checkByte(const Record& r) {
+    const uint8_t bytes[7] = {r.field,
+                              static_cast<uint8_t>(r.seq), static_cast<uint8_t>(r.seq >> 8),
+                              static_cast<uint8_t>(r.value), static_cast<uint8_t>(r.value >> 8),
+                              static_cast<uint8_t>(r.value >> 16), static_cast<uint8_t>(r.value >> 24)};
+    uint8_t crc = 0xFF;
+    for (uint8_t b : bytes) {
+        crc ^= b;
+        for (int j = 0; j < 8; ++j)
+            crc = (crc & 0x80) ? static_cast<uint8_t>((crc << 1) ^ 0x07) : static_cast<uint8_t>(crc << 1);
+    }
+    return crc;
+}
+
+uint32_t JournalSettingsStorage::encode(const SettingsData& d, Field field) {
+    switch (field) {
+    case Field::SpinThreshold: return floatBits(d.spin.threshold);
+    case Field::SpinBufferSize: return static_cast<uint32_t>(d.spin.bufferSize);
+    case Field::SpinExpectedPositions: return static_cast<uint32_t>(d.spin.expectedPositions);
+    case Field::SpinSampleDelayMs: return static_cast<uint32_t>(d.spin.sampleDelayMs);
+    case Field::SpinStallTimeoutSec: return static_cast<uint32_t>(d.spin.stallTimeoutSec);
+    case Field::MenuState: return static_cast<uint32_t>(d.menuState);
+    default: return 0;
+    }
+}
+
+void JournalSettingsStorage::decode(SettingsData& d, Field field, uint32_t value) {
+    switch (field) {
+    case Field::SpinThreshold: d.spin.threshold = bitsFloat(value); break;
+    case Field::SpinBufferSize: d.spin.bufferSize = static_cast<int>(value); break;
+    case Field::SpinExpectedPositions: d.spin.expectedPositions = static_cast<int>(value); break;
+    case Field::SpinSampleDelayMs: d.spin.sampleDelayMs = static_cast<int>(value); break;
+    case Field::SpinStallTimeoutSec: d.spin.stallTimeoutSec = static_cast<int>(value); break;
+    case Field::MenuState: d.menuState = static_cast<PersistedMenuState>(value); break;
+    default: break;
+    }
+}
+
+StorageResult JournalSettingsStorage::scan() {
+    _scanned = true;
+    _haveState = false;
+    _head = 0;
+    _nextSeq = 0;
+    const size_t slots = recordCapacity();
+    // Pass 1 finds the newest record, which fixes the write head and the
+    // reference point for wrap-safe sequence ages.
+    bool any = false;
+    uint16_t newest = 0;
+    size_t newestSlot = 0;
+    for (size_t i = 0; i < slots; ++i) {
+        Record r{};
+        platform_factory::eeprom_read_bytes(slotAddr(i), &r, sizeof(r));
+        if (!validField(r.field) || r.check != checkByte(r))
+            continue;
+        if (!any || static_cast<int16_t>(r.seq - newest) > 0) {
+            newest = r.seq;
+            newestSlot = i;
+            any = true;
+        }
+    }
+    if (!any)
+        return {StorageStatus::NotFound, "journal"};
+    // Pass 2 keeps the youngest record of each field
+    int32_t bestAge[kFieldCount];
+    uint32_t bestValue[kFieldCount] = {};
+    for (auto& a : bestAge) a = INT32_MIN;
+    for (size_t i = 0; i < slots; ++i) {
+        Record r{};
+        platform_factory::eeprom_read_bytes(slotAddr(i), &r, sizeof(r));
+        if (!validField(r.field) || r.check != checkByte(r))
+            continue;
+        const int32_t age = static_cast<int16_t>(r.seq - newest);
+        const size_t f = r.field - 1u;
+        if (age > bestAge[f]) {
+            bestAge[f] = age;
+            bestValue[f] = r.value;
+        }
+    }
+    for (size_t f = 0; f < kFieldCount; ++f) {
+        if (bestAge[f] == INT32_MIN)
+            return {StorageStatus::CorruptData, "journal field missing"};
+        decode(_current, static_cast<Field>(f + 1), bestValue[f]);
+    }
+    _head = newestSlot + 1;
+    _nextSeq = static_cast<uint16_t>(newest + 1);
+    _haveState = true;
+    return {};
+}
+
+StorageResult JournalSettingsStorage::load(SettingsData& data) {
+    if (!platform_factory::has_eeprom()) {
+        (void)data;
+        return {StorageStatus::IoError, "no eeprom"};
+    }
+    if (_halfRecords <= kFieldCount)
+        return {StorageStatus::InvalidFormat, "journal region too small"};
+    platform_factory::eeprom_begin(_size);
+    StorageResult res = scan();
+    platform_factory::eeprom_end();
+    if (res.ok()) {
+        data = _current;
+        _schemaVersion = kSettingsVersion;
+        return res;
+    }
+    // Devices upgraded from the fixed-block layout keep their settings; the
+    // next save replaces the block with a journal snapshot.
+    EEPROMSettingsStorage legacy(_start, _size);
+    SettingsData old{};
+    if (legacy.load(old).ok()) {
+        data = old;
+        _schemaVersion = legacy.getSchemaVersion();
+        return {};
+    }
+    return res;
+}
+
+size_t JournalSettingsStorage::diff(const SettingsData& data, Field* changed) const {
+    size_t n = 0;
+    for (size_t f = 1; f <= kFieldCount; ++f) {
+        const Field field = static_cast<Field>(f);
+        if (!_haveState || encode(data, field) != encode(_current, field))
+            changed[n++] = field;
+    }
+    return n;
+}
+
+void JournalSettingsStorage::writeRecord(Field field, uint32_t value) {
+    Record r{};
+    r.field = static_cast<uint8_t>(field);
+    r.seq = _nextSeq++;
+    r.value = value;
+    r.check = checkByte(r);
+    platform_factory::eeprom_write_bytes(slotAddr(_head), &r, sizeof(r));
+    ++_head;
+}
+
+size_t JournalSettingsStorage::writeSnapshot(const SettingsData& data) {
+    // Always into the half that is not being appended to, so the previous
+    // state survives until the snapshot is complete.
+    _head = (_head > 0 && _head - 1 < _halfRecords) ? _halfRecords : 0;
+    for (size_t f = 1; f <= kFieldCount; ++f)
+        writeRecord(static_cast<Field>(f), encode(data, static_cast<Field>(f)));
+    // Blank the half's older tail: left alone, its sequence numbers would
+    // eventually wrap round to look newer than the live records
+    const Record blank{};
+    for (size_t slot = _head, end = halfEnd(_head - 1); slot < end; ++slot) {
+        Record r{};
+        platform_factory::eeprom_read_bytes(slotAddr(slot), &r, sizeof(r));
+        if (validField(r.field) && r.check == checkByte(r))
+            platform_factory::eeprom_write_bytes(slotAddr(slot), &blank, sizeof(blank));
+    }
+    ++_compactions;
+    return kFieldCount;
+}
+
+StorageResult JournalSettingsStorage::save(const SettingsData& data) {
+    WINDVANE_PROBE(StorageSave);
+    if (!platform_factory::has_eeprom()) {
+        (void)data;
+        return {StorageStatus::IoError, "no eeprom"};
+    }
+    if (_halfRecords <= kFieldCount)
+        return {StorageStatus::InvalidFormat, "journal region too small"};
+    platform_factory::eeprom_begin(_size);
+    if (!_scanned)
+        scan();
+    Field changed[kFieldCount];
+    const size_t n = diff(data, changed);
+    if (n == 0) {
+        platform_factory::eeprom_end();
+        return {};
+    }
+    const bool fits = _haveState && _head + n <= halfEnd(_head - 1);
+    if (fits) {
+        for (size_t i = 0; i < n; ++i)
+            writeRecord(changed[i], encode(data, changed[i]));
+    } else {
+        writeSnapshot(data);
+    }
+    platform_factory::eeprom_commit();
+    platform_factory::eeprom_end();
+    _current = data;
+    _haveState = true;
+    _schemaVersion = kSettingsVersion;
+    return {};
+}
@@ -1,12 +1,16 @@
 #include "SettingsManager.h"
 #include <Calibration/CalibrationConfig.h>
+#include <Calibration/ClusterManager.h>
 
 SettingsManager::SettingsManager(ISettingsStorage& storage, IDiagnostics& diag)
     : _storage(storage), _data(), _diag(diag) {}
 
+SettingsManager::~SettingsManager() { flush(); }
+
 StorageResult SettingsManager::load() {
     StorageResult res = _storage.load(_data);
     ensureValid();
+    _savedRevision = _polledRevision = _revision;
     if (res.ok()) {
         _diag.info("Settings loaded");
     } else {
@@ -21,13 +25,36 @@ void SettingsManager::apply(WindVane& vane) const {
     vane.setCalibrationConfig(cfg);
 }
 
-StorageResult SettingsManager::save() const {
-    StorageResult res = _storage.save(_data);
-    if (res.ok())
+StorageResult SettingsManager::save() {
+    const uint32_t revision = _revision;
+    _lastFlush = _storage.save(_data);
+    if (_lastFlush.ok()) {
+        _savedRevision = revision;
         _diag.info("Settings saved");
-    else
+    } else {
         _diag.warn("Failed to save settings");
-    return res;
+    }
+    return _lastFlush;
+}
+
+StorageResult SettingsManager::flush() {
+    if (!dirty())
+        return {};
+    return save();
+}
+
+StorageResult SettingsManager::poll(platform::TimeMs now) {
+    if (!dirty())
+        return {};
+    if (_revision != _polledRevision) {
+        _polledRevision = _revision;
+        _changedAt = now;
+    }
+    if (now - _changedAt < _flushDelay)
+        return {};
+    // A failed write retries after another idle period rather than every loop
+    _changedAt = now;
+    return save();
 }
 
 float SettingsManager::getSpinThreshold() const { return _data.spin.threshold; }
@@ -39,31 +66,43 @@ int SettingsManager::getSpinStallTimeoutSec() const { return _data.spin.stallTim
 void SettingsManager::setSpinThreshold(float v) {
     _data.spin.threshold = v;
     ensureValid();
+    markDirty();
 }
 void SettingsManager::setSpinBufferSize(int v) {
     _data.spin.bufferSize = v;
     ensureValid();
+    markDirty();
 }
 void SettingsManager::setSpinExpectedPositions(int v) {
     _data.spin.expectedPositions = v;
     ensureValid();
+    markDirty();
 }
 void SettingsManager::setSpinSampleDelayMs(int v) {
     _data.spin.sampleDelayMs = v;
     ensureValid();
+    markDirty();
 }
 void SettingsManager::setSpinStallTimeoutSec(int v) {
     _data.spin.stallTimeoutSec = v;
     ensureValid();
+    markDirty();
 }
 
 void SettingsManager::setMenuState(PersistedMenuState s) {
+    if (_data.menuState == s)
+        return;
     _data.menuState = s;
+    markDirty();
 }
 
 void SettingsManager::ensureValid() {
     if (_data.spin.bufferSize < 1) _data.spin.bufferSize = 1;
+    if (_data.spin.bufferSize > SpinningConfig::kMaxBufferSize)
+        _data.spin.bufferSize = SpinningConfig::kMaxBufferSize;
     if (_data.spin.expectedPositions < 1) _data.spin.expectedPositions = 1;
+    if (_data.spin.expectedPositions > static_cast<int>(ClusterManager::kCapacity))
+        _data.spin.expectedPositions = static_cast<int>(ClusterManager::kCapacity);
     if (_data.spin.sampleDelayMs < 1) _data.spin.sampleDelayMs = 1;
     if (_data.spin.stallTimeoutSec < 1) _data.spin.stallTimeoutSec = 1;
     if (_data.spin.threshold < 0.f) _data.spin.threshold = 0.f;
@@ -0,0 +1,135 @@
+#include "SampleTrace.h"
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define WINDVANE_TRACE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define WINDVANE_TRACE_MMAP 0
+#include <iterator>
+#endif
+
+namespace {
+
+void putU16(unsigned char* p, uint16_t v) {
+    p[0] = static_cast<unsigned char>(v);
+    p[1] = static_cast<unsigned char>(v >> 8);
+}
+
+void putU32(unsigned char* p, uint32_t v) {
+    putU16(p, static_cast<uint16_t>(v));
+    putU16(p + 2, static_cast<uint16_t>(v >> 16));
+}
+
+uint16_t getU16(const unsigned char* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t getU32(const unsigned char* p) {
+    return getU16(p) | (static_cast<uint32_t>(getU16(p + 2)) << 16);
+}
+
+} // namespace
+
+TraceWriter::TraceWriter(const std::string& path)
+    : _out(path, std::ios::binary | std::ios::trunc) {
+    unsigned char hdr[trace_format::kHeaderSize];
+    std::memcpy(hdr, trace_format::kMagic, sizeof(trace_format::kMagic));
+    putU16(hdr + 4, trace_format::kVersion);
+    putU16(hdr + 6, static_cast<uint16_t>(trace_format::kRecordSize));
+    _out.write(reinterpret_cast<const char*>(hdr), sizeof(hdr));
+}
+
+TraceWriter::~TraceWriter() { close(); }
+
+void TraceWriter::append(const TraceRecord& rec) {
+    unsigned char buf[trace_format::kRecordSize];
+    putU32(buf, rec.timestampMs);
+    putU16(buf + 4, rec.code);
+    _out.write(reinterpret_cast<const char*>(buf), sizeof(buf));
+    ++_count;
+}
+
+StorageResult TraceWriter::close() {
+    if (!_out.is_open())
+        return status();
+    _out.flush();
+    StorageResult res = status();
+    _out.close();
+    return res;
+}
+
+StorageResult TraceWriter::status() const {
+    if (!_out)
+        return {StorageStatus::IoError, "write"};
+    return {};
+}
+
+MappedTrace::~MappedTrace() { close(); }
+
+void MappedTrace::close() {
+#if WINDVANE_TRACE_MMAP
+    if (_mapped)
+        munmap(const_cast<unsigned char*>(_data), _length);
+#endif
+    _fallback.clear();
+    _data = nullptr;
+    _length = 0;
+    _count = 0;
+    _mapped = false;
+}
+
+StorageResult MappedTrace::open(const std::string& path) {
+    close();
+#if WINDVANE_TRACE_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return {StorageStatus::NotFound, "open"};
+    struct stat st {};
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return {StorageStatus::IoError, "stat"};
+    }
+    _length = static_cast<size_t>(st.st_size);
+    if (_length >= trace_format::kHeaderSize) {
+        void* p = mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            ::close(fd);
+            _length = 0;
+            return {StorageStatus::IoError, "mmap"};
+        }
+        _data = static_cast<const unsigned char*>(p);
+        _mapped = true;
+    }
+    ::close(fd);
+#else
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs)
+        return {StorageStatus::NotFound, "open"};
+    _fallback.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    _data = _fallback.data();
+    _length = _fallback.size();
+#endif
+    if (_length < trace_format::kHeaderSize ||
+        std::memcmp(_data, trace_format::kMagic, sizeof(trace_format::kMagic)) != 0) {
+        close();
+        return {StorageStatus::InvalidFormat, "magic"};
+    }
+    if (getU16(_data + 4) != trace_format::kVersion ||
+        getU16(_data + 6) != trace_format::kRecordSize) {
+        close();
+        return {StorageStatus::InvalidVersion, "version"};
+    }
+    // A trailing partial record (e.g. power loss mid-write) is ignored
+    _count = (_length - trace_format::kHeaderSize) / trace_format::kRecordSize;
+    return {};
+}
+
+TraceRecord MappedTrace::operator[](size_t index) const {
+    const unsigned char* p =
+        _data + trace_format::kHeaderSize + index * trace_format::kRecordSize;
+    return {getU32(p), getU16(p + 4)};
+}
@@ -0,0 +1,13 @@
+#include "TraceADC.h"
+
+uint16_t RecordingADC::readCode() const {
+    uint16_t code = _source.readCode();
+    _writer.append({platform::toEmbedded(_clock()), code});
+    return code;
+}
+
+uint16_t ReplayADC::readCode() const {
+    if (_trace.empty()) return 0;
+    size_t index = _cursor < _trace.size() ? _cursor++ : _trace.size() - 1;
+    return _trace[index].code;
+}
@@ -0,0 +1,62 @@
+#include "TraceReplay.h"
+#include "TraceADC.h"
+#include "Calibration/Strategies/SpinningMethod.h"
+#include "Diagnostics/IDiagnostics.h"
+#include "Storage/ICalibrationStorage.h"
+
+namespace {
+
+// Starts empty and keeps whatever the session saves.
+class CaptureStorage : public ICalibrationStorage {
+public:
+    explicit CaptureStorage(std::vector<ClusterData>& out) : _out(out) {}
+    StorageResult save(const std::vector<ClusterData>& clusters, int version) override {
+        _out = clusters;
+        _version = version;
+        return {};
+    }
+    StorageResult load(std::vector<ClusterData>&, int&) override {
+        return {StorageStatus::NotFound, {}};
+    }
+    int getSchemaVersion() const override { return _version; }
+    StorageResult clear() override { return {}; }
+
+private:
+    std::vector<ClusterData>& _out;
+    int _version{0};
+};
+
+class SilentDiagnostics : public IDiagnostics {
+public:
+    void info(const char*) override {}
+    void warn(const char*) override {}
+    void log(const DiagnosticsEvent&) override {}
+};
+
+} // namespace
+
+ReplayResult TraceReplay::run(const SpinningConfig& config) const {
+    ReplayResult result;
+    if (_trace.empty()) return result;
+
+    ReplayADC adc(_trace);
+    CaptureStorage storage(result.clusters);
+    SilentDiagnostics diag;
+    SpinningMethod method({adc, storage, diag, config});
+
+    method.beginSession(platform::TimeMs{_trace[0].timestampMs});
+    size_t i = 0;
+    for (; i < _trace.size(); ++i) {
+        // Records between sample periods are skipped, as a device running
+        // at config.sampleDelayMs would never have read them
+        adc.seek(i);
+        if (!method.step(platform::TimeMs{_trace[i].timestampMs})) {
+            ++i;
+            break;
+        }
+    }
+    method.finishSession(); // trace ended mid-session
+    result.samples = i;
+    result.progress = method.progress();
+    return result;
+}
@@ -12,30 +12,86 @@
 
 // Existing full-config constructor (unchanged)
 WindVane::WindVane(const WindVaneConfig& cfg)
-    : _adc(cfg.adc), _type(cfg.type), _storage(cfg.storage) {
+    : _adc(cfg.adc), _averager(cfg.averager), _type(cfg.type),
+      _storage(cfg.storage) {
   StrategyContext ctx{cfg.method, cfg.adc, cfg.storage,
                       cfg.diag, cfg.config};
   auto strategy = createCalibrationStrategy(ctx);
   _calibrationManager = std::make_unique<CalibrationManager>(
       std::move(strategy));
+  if (cfg.filter.type != FilterType::None)
+    _filtered = std::make_unique<FilteredADC>(cfg.adc, cfg.filter);
 }
 
 // --- New: user-friendly alias for calibration ---
 CalibrationResult WindVane::calibrate() { return runCalibration(); }
 
+float WindVane::sample(platform::TimeMs now) {
+  float direction = getInstantDirection();
+  if (!_averager) return direction;
+  _averager->add(direction, now);
+  return _averager->stats().meanDeg;
+}
+
 float WindVane::getDirection() const {
+  if (_averager) {
+    const DirectionStats stats = _averager->stats();
+    if (stats.valid()) return stats.meanDeg;
+  }
+  return getInstantDirection();
+}
+
+DirectionStats WindVane::getDirectionStats() const {
+  return _averager ? _averager->stats() : DirectionStats{};
+}
+
+float WindVane::getInstantDirection() const {
   float raw = getRawDirection();
   return _calibrationManager ? _calibrationManager->getCalibratedData(raw)
                              : raw * 360.0f;
 }
 
-float WindVane::getRawDirection() const { return _adc.read(); }
+uint16_t WindVane::getDirectionCentidegrees() const {
+  uint16_t code = directionInput().readCode();
+  if (_calibrationManager)
+    return _calibrationManager->getCalibratedCentidegrees(code);
+  return static_cast<uint16_t>(
+      (static_cast<uint32_t>(code) * 36000UL + 2047UL) / 4095UL % 36000UL);
+}
+
+float WindVane::getRawDirection() const { return directionInput().read(); }
+
+const IADC& WindVane::directionInput() const {
+  return _filtered ? static_cast<const IADC&>(*_filtered) : _adc;
+}
 
 CalibrationResult WindVane::runCalibration() {
   if (_calibrationManager) return _calibrationManager->runCalibration();
   return {};
 }
 
+CalibrationResult WindVane::startCalibration(platform::TimeMs now) {
+  if (_calibrationManager) return _calibrationManager->startSession(now);
+  return {};
+}
+
+bool WindVane::stepCalibration(platform::TimeMs now) {
+  return _calibrationManager && _calibrationManager->stepSession(now);
+}
+
+void WindVane::abortCalibration() {
+  if (_calibrationManager) _calibrationManager->abortSession();
+}
+
+void WindVane::finishCalibration() {
+  if (_calibrationManager) _calibrationManager->finishSession();
+}
+
+CalibrationProgress WindVane::getCalibrationProgress() const {
+  return _calibrationManager ? _calibrationManager->sessionProgress()
+                             : CalibrationProgress{};
+}
+
 CalibrationManager::CalibrationStatus WindVane::getCalibrationStatus() const {
   return _calibrationManager
              ? _calibrationManager->getStatus()
@@ -0,0 +1,20 @@
+#include <benchmark/benchmark.h>
+#include "WindVane/Acquisition/IAcquisition.h"
+
+namespace {
+
+// Producer/consumer cost on one thread: push a block, then drain it.
+void BM_SampleRingBlock(benchmark::State& state) {
+    const size_t block = static_cast<size_t>(state.range(0));
+    SampleRing<AcquiredSample, AcquisitionBase::kRingCapacity> ring;
+    AcquiredSample out[AcquisitionBase::kRingCapacity];
+    uint32_t t = 0;
+    for (auto _ : state) {
+        for (size_t i = 0; i < block; ++i) { ring.push({t, static_cast<uint16_t>(t & 0xFFF)}); ++t; }
+        benchmark::DoNotOptimize(ring.readBlock(out, block));
+    }
+    state.SetItemsProcessed(state.iterations() * block);
+}
+BENCHMARK(BM_SampleRingBlock)->Arg(1)->Arg(32)->Arg(256);
+
+} // namespace
@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+#include "WindVane/Calibration/ClusterManager.h"
+#include "bench_profiles.h"
+
+namespace {
+
+using BenchClusterManager = BasicClusterManager<360>;
+
+void loadProfile(ClusterManagerBase& mgr, int positions) {
+    mgr.setClusters(bench::ladderProfile(positions));
+}
+
+// Noisy samples around each detent of the profile, in sweep order.
+std::vector<float> detentSamples(int positions, int perDetent) {
+    std::vector<float> samples;
+    for (const ClusterData& c : bench::ladderProfile(positions)) {
+        for (int s = 0; s < perDetent; ++s)
+            samples.push_back(c.mean + (s % 5 - 2) * (c.max - c.mean) * 0.4f);
+    }
+    return samples;
+}
+
+// Readings as produced by ESP32ADC::read for a vane sweeping all codes.
+std::vector<float> makeReadings() {
+    std::vector<float> readings(ClusterManagerBase::kLookupSize);
+    for (size_t code = 0; code < readings.size(); ++code)
+        readings[code] = code / 4095.0f;
+    return readings;
+}
+
+void BM_InterpolateScan(benchmark::State& state) {
+    BenchClusterManager mgr;
+    loadProfile(mgr, static_cast<int>(state.range(0)));
+    const std::vector<float> readings = makeReadings();
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mgr.interpolateScan(readings[i]));
+        i = (i + 1) & (readings.size() - 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_InterpolateLookup(benchmark::State& state) {
+    BenchClusterManager mgr;
+    loadProfile(mgr, static_cast<int>(state.range(0)));
+    const std::vector<float> readings = makeReadings();
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mgr.interpolate(readings[i]));
+        i = (i + 1) & (readings.size() - 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_InterpolateBatch(benchmark::State& state) {
+    BenchClusterManager mgr;
+    loadProfile(mgr, static_cast<int>(state.range(0)));
+    const std::vector<float> readings = makeReadings();
+    std::vector<float> degrees(readings.size());
+    for (auto _ : state) {
+        mgr.interpolateBatch(readings.data(), degrees.data(), readings.size());
+        benchmark::DoNotOptimize(degrees.data());
+    }
+    state.SetItemsProcessed(state.iterations() * readings.size());
+}
+
+// One calibration's worth of samples clustered from empty, per iteration.
+void BM_AddOrUpdate(benchmark::State& state) {
+    const int positions = static_cast<int>(state.range(0));
+    const std::vector<float> samples = detentSamples(positions, 20);
+    const float threshold = 0.3f / positions;
+    BenchClusterManager mgr;
+    for (auto _ : state) {
+        mgr.clear();
+        for (float r : samples) mgr.addOrUpdate(r, threshold);
+        benchmark::DoNotOptimize(mgr.clusters().data());
+    }
+    state.SetItemsProcessed(state.iterations() * samples.size());
+}
+
+// Merge pass over twice the final cluster count, including the table rebuild.
+void BM_MergeAndPrune(benchmark::State& state) {
+    const int positions = static_cast<int>(state.range(0));
+    std::vector<ClusterData> raw = bench::ladderProfile(positions);
+    std::vector<ClusterData> split;
+    for (const ClusterData& c : raw) {
+        split.push_back({c.mean - 0.01f / positions, c.min, c.mean, 5});
+        split.push_back({c.mean + 0.01f / positions, c.mean, c.max, 5});
+    }
+    BenchClusterManager mgr;
+    for (auto _ : state) {
+        state.PauseTiming();
+        mgr.setClusters(split);
+        state.ResumeTiming();
+        mgr.mergeAndPrune(0.1f / positions, 2);
+        benchmark::DoNotOptimize(mgr.clusters().data());
+    }
+    state.SetItemsProcessed(state.iterations() * split.size());
+}
+
+} // namespace
+
+BENCHMARK(BM_InterpolateScan)->Apply(bench::positionProfiles);
+BENCHMARK(BM_InterpolateLookup)->Apply(bench::positionProfiles);
+BENCHMARK(BM_InterpolateBatch)->Apply(bench::positionProfiles);
+BENCHMARK(BM_AddOrUpdate)->Apply(bench::positionProfiles);
+BENCHMARK(BM_MergeAndPrune)->Apply(bench::positionProfiles);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "WindVane/Acquisition/DecimationFilter.h"
+#include "WindVane/Acquisition/FilteredADC.h"
+#include "WindVane/Drivers/SimulatedVaneADC.h"
+
+namespace {
+
+std::vector<uint16_t> noisyCodes(size_t n) {
+    std::vector<uint16_t> codes(n);
+    uint32_t x = 0x9E3779B9u;
+    for (auto& c : codes) {
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        c = static_cast<uint16_t>(2048 + (x & 0x1F) - 16);
+    }
+    return codes;
+}
+
+// Cost per output sample of the filter alone over a buffered block, as fed
+// from an acquisition ring. Arg is the decimation ratio.
+void runFilter(benchmark::State& state, FilterConfig cfg) {
+    cfg.decimation = static_cast<uint16_t>(state.range(0));
+    cfg.window = cfg.decimation;
+    const auto codes = noisyCodes(4096);
+    std::vector<float> out(codes.size() + 1);
+    DecimationFilter filter(cfg);
+    size_t outputs = 0;
+    for (auto _ : state) {
+        outputs += filter.process(codes.data(), codes.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(outputs);
+    state.counters["ns_per_output"] = benchmark::Counter(
+        static_cast<double>(outputs), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+void BM_DecimateMovingAverage(benchmark::State& state) {
+    runFilter(state, {FilterType::MovingAverage, 1, 1, 1});
+}
+BENCHMARK(BM_DecimateMovingAverage)->Arg(4)->Arg(16)->Arg(64);
+
+void BM_DecimateCic2(benchmark::State& state) { runFilter(state, {FilterType::CIC, 1, 1, 2}); }
+BENCHMARK(BM_DecimateCic2)->Arg(4)->Arg(16)->Arg(64);
+
+void BM_DecimateCic3(benchmark::State& state) { runFilter(state, {FilterType::CIC, 1, 1, 3}); }
+BENCHMARK(BM_DecimateCic3)->Arg(4)->Arg(16)->Arg(64);
+
+// End to end through the IADC stage, including the source reads.
+void BM_FilteredADCRead(benchmark::State& state) {
+    SimulatedVaneADC raw;
+    raw.setAngle(135.0f);
+    FilteredADC filtered(raw, {FilterType::CIC, static_cast<uint16_t>(state.range(0)), 1, 2});
+    for (auto _ : state) benchmark::DoNotOptimize(filtered.read());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FilteredADCRead)->Arg(1)->Arg(16);
+
+} // namespace
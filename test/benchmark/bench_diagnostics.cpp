@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <vector>
+#include "WindVane/Diagnostics/DiagnosticsBus.h"
+
+namespace {
+
+class CountingSink : public IDiagnosticsSink {
+public:
+    void handle(const DiagnosticsEvent& ev) override {
+        benchmark::DoNotOptimize(&ev);
+        ++count;
+    }
+    size_t count{0};
+};
+
+// A sink that renders every event, as console and Serial sinks do
+class RenderingSink : public IDiagnosticsSink {
+public:
+    void handle(const DiagnosticsEvent& ev) override {
+        char buf[128];
+        benchmark::DoNotOptimize(ev.render(buf, sizeof(buf)));
+    }
+};
+
+constexpr unsigned kIndex = 12;
+constexpr float kMean = 0.4375f, kMin = 0.431f, kMax = 0.444f;
+constexpr int kCount = 42;
+
+// Previous call-site pattern: format at the caller, then hand the bus text.
+void BM_DiagnosticsSnprintfInfo(benchmark::State& state) {
+    std::vector<CountingSink> sinks(static_cast<size_t>(state.range(0)));
+    DiagnosticsBus bus;
+    for (CountingSink& s : sinks) bus.addSink(&s);
+    for (auto _ : state) {
+        char msg[128];
+        snprintf(msg, sizeof(msg), "Cluster %u: mean=%f min=%f max=%f count=%d", kIndex,
+                 kMean, kMin, kMax, kCount);
+        bus.info(msg);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Deferred formatting: arguments are captured, sinks render if they want.
+void BM_DiagnosticsInfof(benchmark::State& state) {
+    std::vector<CountingSink> sinks(static_cast<size_t>(state.range(0)));
+    DiagnosticsBus bus;
+    for (CountingSink& s : sinks) bus.addSink(&s);
+    for (auto _ : state)
+        bus.infof("Cluster %u: mean=%f min=%f max=%f count=%d", kIndex, kMean, kMin, kMax, kCount);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Worst case for deferral: one text sink renders every event.
+void BM_DiagnosticsInfofRendered(benchmark::State& state) {
+    RenderingSink sink;
+    DiagnosticsBus bus;
+    bus.addSink(&sink);
+    for (auto _ : state)
+        bus.infof("Cluster %u: mean=%f min=%f max=%f count=%d", kIndex, kMean, kMin, kMax, kCount);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Plain text messages, copied into the event.
+void BM_DiagnosticsBusInfo(benchmark::State& state) {
+    std::vector<CountingSink> sinks(static_cast<size_t>(state.range(0)));
+    DiagnosticsBus bus;
+    for (CountingSink& s : sinks) bus.addSink(&s);
+    for (auto _ : state)
+        bus.info("Cluster 12: mean=0.437500 min=0.431000 max=0.444000 count=42");
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Producer-side cost in async mode: enqueue only, a drain thread delivers.
+void BM_DiagnosticsAsyncInfof(benchmark::State& state) {
+    CountingSink sink;
+    DiagnosticsBus bus;
+    bus.addSink(&sink);
+    bus.startAsync();
+    for (auto _ : state)
+        bus.infof("Cluster %u: mean=%f min=%f max=%f count=%d", kIndex, kMean, kMin, kMax, kCount);
+    bus.stopAsync();
+    state.SetItemsProcessed(state.iterations());
+    state.counters["dropped"] = static_cast<double>(bus.dropped());
+}
+
+} // namespace
+
+BENCHMARK(BM_DiagnosticsAsyncInfof)->Threads(1)->Threads(4);
+BENCHMARK(BM_DiagnosticsSnprintfInfo)->Arg(0)->Arg(1)->Arg(4);
+BENCHMARK(BM_DiagnosticsInfof)->Arg(0)->Arg(1)->Arg(4);
+BENCHMARK(BM_DiagnosticsInfofRendered);
+BENCHMARK(BM_DiagnosticsBusInfo)->Arg(0)->Arg(1)->Arg(4)->Arg(16);
@@ -0,0 +1,26 @@
+#include <benchmark/benchmark.h>
+#include "WindVane/Processing/DirectionAverager.h"
+
+namespace {
+
+// Per-sample update cost; Arg is the window in seconds at 1 kHz, which
+// must not change the cost.
+void BM_DirectionAveragerAdd(benchmark::State& state) {
+    DirectionAverager avg(platform::TimeMs{static_cast<uint32_t>(state.range(0) * 1000)}, 60);
+    uint32_t t = 0;
+    for (auto _ : state) {
+        avg.addCentidegrees(static_cast<uint16_t>((t * 37) % 36000), platform::TimeMs{t});
+        ++t;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DirectionAveragerAdd)->Arg(2)->Arg(600);
+
+void BM_DirectionAveragerStats(benchmark::State& state) {
+    DirectionAverager avg;
+    for (uint32_t t = 0; t < 2000; ++t) avg.add(static_cast<float>(t % 360), platform::TimeMs{t});
+    for (auto _ : state) benchmark::DoNotOptimize(avg.stats());
+}
+BENCHMARK(BM_DirectionAveragerStats);
+
+} // namespace
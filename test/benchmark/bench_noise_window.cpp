@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <deque>
+#include <random>
+#include <vector>
+#include "WindVane/Calibration/NoiseWindow.h"
+
+namespace {
+
+constexpr float kThreshold = 0.05f;
+
+std::vector<float> makeReadings() {
+    std::mt19937 rng(11);
+    std::normal_distribution<float> noise(0.0f, 0.01f);
+    std::vector<float> readings(4096);
+    for (size_t i = 0; i < readings.size(); ++i) {
+        float centre = static_cast<float>((i / 64) % 16) / 16.0f + 0.03f;
+        readings[i] = centre + noise(rng);
+    }
+    return readings;
+}
+
+// Baseline: deque plus full rescan per sample, as updateClusters used to do.
+void BM_NoiseFilterDequeScan(benchmark::State& state) {
+    const size_t size = static_cast<size_t>(state.range(0));
+    const std::vector<float> readings = makeReadings();
+    std::deque<float> recent;
+    size_t i = 0;
+    for (auto _ : state) {
+        float reading = readings[i++ & (readings.size() - 1)];
+        recent.push_back(reading);
+        if (recent.size() > size) recent.pop_front();
+        size_t inRange = 0;
+        for (float r : recent) {
+            if (std::fabs(r - reading) < kThreshold) ++inRange;
+        }
+        benchmark::DoNotOptimize(inRange);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NoiseFilterDequeScan)->Arg(5)->Arg(50)->Arg(100);
+
+void BM_NoiseFilterWindow(benchmark::State& state) {
+    const std::vector<float> readings = makeReadings();
+    NoiseWindow window;
+    window.reset(static_cast<int>(state.range(0)));
+    size_t i = 0;
+    for (auto _ : state) {
+        float reading = readings[i++ & (readings.size() - 1)];
+        window.push(reading);
+        benchmark::DoNotOptimize(window.countWithin(reading, kThreshold));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NoiseFilterWindow)->Arg(5)->Arg(50)->Arg(100);
+
+} // namespace
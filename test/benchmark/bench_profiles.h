@@ -0,0 +1,29 @@
+#pragma once
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "WindVane/Calibration/ClusterData.h"
+
+namespace bench {
+
+// Detent counts seen in the field: 8/16-position reed vanes, 32/64 for
+// optical encoders, and 360 for one cluster per degree.
+inline void positionProfiles(benchmark::internal::Benchmark* b) {
+    for (int n : {8, 16, 32, 64, 360}) b->Arg(n);
+}
+
+// Resistor-ladder vane: detent gaps vary by up to 4x around the circle and
+// the first detent sits just above zero so the wrap segment is exercised.
+inline std::vector<ClusterData> ladderProfile(int positions) {
+    std::vector<ClusterData> clusters;
+    float total = 0.0f;
+    for (int i = 0; i < positions; ++i) total += 1.0f + (i % 4);
+    float mean = 0.01f;
+    for (int i = 0; i < positions; ++i) {
+        float spread = 0.2f / positions;
+        clusters.push_back({mean, mean - spread, mean + spread, 10});
+        mean += (1.0f + (i % 4)) / total * 0.98f;
+    }
+    return clusters;
+}
+
+} // namespace bench
@@ -0,0 +1,15 @@
+#include <benchmark/benchmark.h>
+#include "WindVane/Drivers/SimulatedVaneADC.h"
+
+namespace {
+
+// Sample generation rate for load-testing calibration without hardware.
+void BM_SimulatedVaneRead(benchmark::State& state) {
+    SimulatedVaneADC adc;
+    adc.setScript(RotationScript{}.spin(0.0f, 1.0f, 4000).loop());
+    for (auto _ : state) benchmark::DoNotOptimize(adc.readCode());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SimulatedVaneRead);
+
+} // namespace
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <vector>
+#include "WindVane/IADC.h"
+#include "WindVane/Calibration/SpinningMethod.h"
+#include "WindVane/Diagnostics/IDiagnostics.h"
+#include "WindVane/Storage/ICalibrationStorage.h"
+#include "bench_profiles.h"
+#include "test_doubles.h"
+
+namespace {
+
+using doubles::NullDiagnostics;
+using doubles::NullStorage;
+
+// Sweeps the profile's detents, dwelling on each for a few samples.
+class ProfileADC : public IADC {
+public:
+    explicit ProfileADC(int positions) {
+        for (const ClusterData& c : bench::ladderProfile(positions))
+            for (int s = 0; s < 6; ++s)
+                _samples.push_back(c.mean + (s % 3 - 1) * (c.max - c.mean) * 0.3f);
+    }
+    float read() const override {
+        float r = _samples[_next];
+        if (++_next == _samples.size()) _next = 0;
+        return r;
+    }
+
+private:
+    std::vector<float> _samples;
+    mutable size_t _next{0};
+};
+
+// processReading is private; step() with the clock advanced by one sample
+// period runs exactly one ADC read plus processReading.
+void BM_ProcessReading(benchmark::State& state) {
+    const int positions = static_cast<int>(state.range(0));
+    ProfileADC adc(positions);
+    NullStorage storage;
+    NullDiagnostics diag;
+    SpinningConfig cfg;
+    cfg.threshold = std::min(0.05f, 0.3f / positions);
+    cfg.expectedPositions = static_cast<int>(ClusterManager::kCapacity);
+    cfg.stallTimeoutSec = 3600;
+    SpinningMethod method({adc, storage, diag, cfg});
+
+    platform::TimeMs now{0};
+    const platform::TimeMs period{static_cast<platform::TimeMs::rep>(cfg.sampleDelayMs)};
+    method.beginSession(now);
+    for (auto _ : state) {
+        now += period;
+        if (!method.step(now)) {
+            state.PauseTiming();
+            method.beginSession(now);
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+// Profiles beyond ClusterManager::kCapacity overflow the default manager,
+// so 360 is covered by the ClusterManager benchmarks only.
+BENCHMARK(BM_ProcessReading)->Arg(8)->Arg(16)->Arg(32)->Arg(64);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "WindVane/Drivers/SimulatedVaneADC.h"
+#include "WindVane/Station/WindVaneStation.h"
+#include "WindVane/Diagnostics/IDiagnostics.h"
+#include "WindVane/Storage/ICalibrationStorage.h"
+#include "WindVane/UI/IIO.h"
+#include "test_doubles.h"
+
+namespace {
+
+using doubles::NullDiagnostics;
+using doubles::NullIO;
+using doubles::NullStorage;
+
+// Aggregate samples/sec with every vane permanently due, so the figure is
+// the station's ceiling rather than the configured rates. Arg is the vane
+// count; workers are capped at the hardware thread count.
+void BM_StationScaling(benchmark::State& state) {
+    const size_t vanes = static_cast<size_t>(state.range(0));
+    const size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    NullIO io;
+    NullDiagnostics diag;
+    std::vector<std::unique_ptr<SimulatedVaneADC>> adcs;
+    std::vector<NullStorage> storage(vanes);
+    WindVaneStation station(io, diag);
+    for (size_t i = 0; i < vanes; ++i) {
+        SimulatedVaneConfig cfg;
+        cfg.seed = static_cast<uint32_t>(i + 1);
+        adcs.push_back(std::make_unique<SimulatedVaneADC>(cfg));
+        adcs.back()->setScript(RotationScript{}.spin(0.0f, 0.5f + 0.1f * i, 60000).loop());
+        StationVaneConfig vane{*adcs.back(), storage[i]};
+        vane.sampleRateHz = 1000000;
+        station.addVane(vane);
+    }
+
+    uint64_t samples = 0;
+    for (auto _ : state) {
+        const uint64_t before = station.totalSamples();
+        station.start(workers);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        station.stop();
+        samples += station.totalSamples() - before;
+    }
+    state.counters["samples_per_second"] =
+        benchmark::Counter(static_cast<double>(samples), benchmark::Counter::kIsRate);
+    state.counters["workers"] = static_cast<double>(std::min(workers, vanes));
+}
+BENCHMARK(BM_StationScaling)
+    ->RangeMultiplier(2)
+    ->Range(1, 64)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,151 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include "WindVane/Storage/CalibrationStorageBase.h"
+#include "WindVane/Storage/Crc32.h"
+#include "WindVane/Storage/EEPROMCalibrationStorage.h"
+#include "WindVane/Storage/EEPROMSettingsStorage.h"
+#include "WindVane/Storage/EepromIO.h"
+#include "WindVane/Storage/EmulatedEeprom.h"
+#include "WindVane/Storage/JournalSettingsStorage.h"
+#include "bench_profiles.h"
+
+namespace {
+
+// Exposes the protected checksum helpers for measurement.
+class CrcProbe : public CalibrationStorageBase {
+public:
+    using CalibrationStorageBase::crc32;
+    StorageResult save(const std::vector<ClusterData>&, int) override { return {}; }
+    StorageResult load(std::vector<ClusterData>&, int&) override { return {}; }
+    StorageResult clear() override { return {}; }
+};
+
+// Bit-at-a-time loop the storage classes used before the slice-by-8 tables
+uint32_t bitwiseCrc32(const unsigned char* data, size_t len) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= data[i];
+        for (int j = 0; j < 8; ++j)
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+void BM_Crc32Clusters(benchmark::State& state) {
+    const std::vector<ClusterData> clusters =
+        bench::ladderProfile(static_cast<int>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(CrcProbe::crc32(clusters));
+    state.SetBytesProcessed(state.iterations() * clusters.size() * sizeof(ClusterData));
+}
+
+// Arg: 0 bitwise reference, 1 slice-by-8 CRC-32, 2 CRC-32C (hardware when available)
+void BM_Crc32Blob(benchmark::State& state) {
+    std::vector<unsigned char> blob(4096);
+    for (size_t i = 0; i < blob.size(); ++i)
+        blob[i] = static_cast<unsigned char>(i * 131u);
+    const int64_t mode = state.range(0);
+    for (auto _ : state) {
+        uint32_t crc = mode == 0 ? bitwiseCrc32(blob.data(), blob.size())
+                     : Crc32::compute(mode == 1 ? CrcKind::Ieee : CrcKind::Castagnoli,
+                                      blob.data(), blob.size());
+        benchmark::DoNotOptimize(crc);
+    }
+    state.SetBytesProcessed(state.iterations() * blob.size());
+    state.SetLabel(mode == 0 ? "bitwise" : mode == 1 ? "slice-by-8"
+                   : Crc32::hardwareAccelerated() ? "crc32c-hw" : "crc32c-table");
+}
+
+class BenchPlatform : public IPlatform {
+public:
+    platform::TimeMs millis() const override { return platform::TimeMs{++_ms}; }
+    void renderStatusLine(MenuPresenter&, const WindVaneStatus&, const char*,
+                          const std::string&, MenuStatusLevel) const override {}
+    bool supportsColor() const override { return false; }
+
+private:
+    mutable uint32_t _ms{0};
+};
+
+// Installs a fresh file-backed EEPROM for the duration of a benchmark
+class EmulatedEepromScope {
+public:
+    EmulatedEepromScope() {
+        std::remove(kPath);
+        _eeprom = std::make_unique<EmulatedEeprom>(kPath);
+        platform_factory::use_emulated_eeprom(_eeprom.get());
+        platform_factory::eeprom_reset_stats();
+    }
+    ~EmulatedEepromScope() {
+        platform_factory::use_emulated_eeprom(nullptr);
+        _eeprom.reset();
+        std::remove(kPath);
+    }
+    EmulatedEeprom& eeprom() { return *_eeprom; }
+
+private:
+    static constexpr const char* kPath = "bench_eeprom.bin";
+    std::unique_ptr<EmulatedEeprom> _eeprom;
+};
+
+void reportWear(benchmark::State& state, EmulatedEeprom& eeprom) {
+    const auto stats = platform_factory::eeprom_stats();
+    const double n = static_cast<double>(state.iterations());
+    state.counters["bytes/op"] = stats.bytesWritten / n;
+    state.counters["commits/op"] = stats.commits / n;
+    state.counters["erases/op"] = eeprom.erases() / n;
+}
+
+// Saves alternate between two calibrations so every save changes data and
+// rotates through the slots.
+void BM_EepromCalibrationSave(benchmark::State& state) {
+    EmulatedEepromScope scope;
+    BenchPlatform platform;
+    EEPROMCalibrationStorage storage(platform, 0, 4096);
+    const auto a = bench::ladderProfile(static_cast<int>(state.range(0)));
+    auto b = a;
+    b[0].count += 1;
+    bool flip = false;
+    for (auto _ : state) {
+        storage.save(flip ? a : b, 1);
+        flip = !flip;
+    }
+    reportWear(state, scope.eeprom());
+}
+
+void BM_EepromCalibrationLoad(benchmark::State& state) {
+    EmulatedEepromScope scope;
+    BenchPlatform platform;
+    EEPROMCalibrationStorage storage(platform, 0, 4096);
+    storage.save(bench::ladderProfile(static_cast<int>(state.range(0))), 1);
+    std::vector<ClusterData> loaded;
+    int version = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(storage.load(loaded, version));
+}
+
+// Arg: 0 fixed settings block, 1 journal. Each save is one menu navigation.
+void BM_EepromSettingsNavigation(benchmark::State& state) {
+    EmulatedEepromScope scope;
+    EEPROMSettingsStorage fixed(256, 512);
+    JournalSettingsStorage journal(256, 512);
+    ISettingsStorage& storage = state.range(0) ? static_cast<ISettingsStorage&>(journal) : fixed;
+    SettingsData data{};
+    int i = 0;
+    for (auto _ : state) {
+        data.menuState = static_cast<PersistedMenuState>(++i % 2);
+        storage.save(data);
+    }
+    reportWear(state, scope.eeprom());
+    state.SetLabel(state.range(0) ? "journal" : "fixed");
+}
+
+} // namespace
+
+BENCHMARK(BM_EepromCalibrationSave)->Arg(4)->Arg(16);
+BENCHMARK(BM_EepromCalibrationLoad)->Arg(4)->Arg(16);
+BENCHMARK(BM_EepromSettingsNavigation)->Arg(0)->Arg(1);
+BENCHMARK(BM_Crc32Clusters)->Apply(bench::positionProfiles);
+BENCHMARK(BM_Crc32Blob)->DenseRange(0, 2);
@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <string>
+#include "WindVane/Trace/SampleTrace.h"
+#include "WindVane/Trace/TraceReplay.h"
+
+namespace {
+
+// Sixteen detents, 20 samples each at 10 ms, with +/-1 code of noise.
+std::string writeTrace() {
+    std::string path = "/tmp/windvane_bench_trace.wvtr";
+    TraceWriter writer(path);
+    uint32_t t = 0;
+    for (int d = 0; d < 16; ++d) {
+        uint16_t code = static_cast<uint16_t>((0.03f + d / 16.0f) * 4095.0f);
+        for (int s = 0; s < 20; ++s, t += 10)
+            writer.append({t, static_cast<uint16_t>(code + (s % 3) - 1)});
+    }
+    writer.close();
+    return path;
+}
+
+void BM_TraceReplaySession(benchmark::State& state) {
+    const std::string path = writeTrace();
+    MappedTrace trace;
+    if (!trace.open(path).ok()) {
+        state.SkipWithError("could not open trace");
+        return;
+    }
+    SpinningConfig cfg;
+    cfg.threshold = 0.02f;
+    cfg.bufferSize = static_cast<int>(state.range(0));
+    TraceReplay replay(trace);
+    for (auto _ : state) {
+        ReplayResult r = replay.run(cfg);
+        benchmark::DoNotOptimize(r.clusters.data());
+    }
+    state.SetItemsProcessed(state.iterations()); // sessions per second
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_TraceReplaySession)->Arg(5)->Arg(50);
+
+} // namespace
@@ -0,0 +1,95 @@
+#pragma once
+#include <vector>
+#include "WindVane/IADC.h"
+#include "WindVane/Diagnostics/IDiagnostics.h"
+#include "WindVane/Storage/ICalibrationStorage.h"
+#include "WindVane/UI/IIO.h"
+
+// Test doubles shared by the unit tests and benchmarks.
+namespace doubles {
+
+class NullIO : public IUserIO {
+public:
+    bool hasInput() const override { return false; }
+    char readInput() const override { return 0; }
+    void flushInput() const override {}
+    void waitMs(platform::TimeMs) const override {}
+    bool yesNoPrompt(const char*) const override { return false; }
+};
+
+// Discards everything, including structured events, so benchmarks do not
+// pay for rendering
+class NullDiagnostics : public IDiagnostics {
+public:
+    void info(const char*) override {}
+    void warn(const char*) override {}
+    void log(const DiagnosticsEvent&) override {}
+};
+
+// Never holds a calibration; counts calls so tests can check routing
+class NullStorage : public ICalibrationStorage {
+public:
+    StorageResult save(const std::vector<ClusterData>&, int) override { ++saves; return {}; }
+    StorageResult load(std::vector<ClusterData>&, int&) override {
+        ++loads;
+        return {StorageStatus::NotFound, {}};
+    }
+    int getSchemaVersion() const override { return 0; }
+    StorageResult clear() override { ++clears; return {}; }
+
+    int saves{0};
+    int loads{0};
+    int clears{0};
+};
+
+// Keeps the last saved calibration in RAM
+class MemoryStorage : public ICalibrationStorage {
+public:
+    StorageResult save(const std::vector<ClusterData>& clusters, int version) override {
+        saved = clusters;
+        _version = version;
+        ++saves;
+        return {};
+    }
+    StorageResult load(std::vector<ClusterData>& clusters, int& version) override {
+        if (saved.empty()) return {StorageStatus::NotFound, {}};
+        clusters = saved;
+        version = _version;
+        return {};
+    }
+    int getSchemaVersion() const override { return _version; }
+    StorageResult clear() override {
+        saved.clear();
+        return {};
+    }
+
+    std::vector<ClusterData> saved;
+    int saves{0};
+
+private:
+    int _version{0};
+};
+
+// Dwells on each of `positions` evenly spaced detents for
+// samplesPerDetent reads, then moves on. `stuck` holds it on the first.
+class DetentADC : public IADC {
+public:
+    explicit DetentADC(int positions, int samplesPerDetent = 8)
+        : _positions(positions), _samplesPerDetent(samplesPerDetent) {}
+
+    float read() const override {
+        ++reads;
+        if (stuck) return 0.03f;
+        int detent = (reads / _samplesPerDetent) % _positions;
+        return 0.03f + static_cast<float>(detent) / _positions;
+    }
+
+    mutable int reads{0};
+    bool stuck{false};
+
+private:
+    int _positions;
+    int _samplesPerDetent;
+};
+
+} // namespace doubles
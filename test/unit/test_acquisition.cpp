@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <limits>
+#include <thread>
+#include <vector>
+#include "WindVane/Acquisition/AcquisitionADC.h"
+#include "WindVane/Acquisition/SampleRing.h"
+#include "WindVane/Acquisition/ThreadedAcquisition.h"
+#include "WindVane/Drivers/SimulatedVaneADC.h"
+
+using namespace testing;
+
+namespace {
+
+class FloatADC : public IADC {
+public:
+    explicit FloatADC(float v) : _v(v) {}
+    float read() const override { return _v; }
+
+private:
+    float _v;
+};
+
+} // namespace
+
+TEST(IADCTest, DefaultReadCode_ClampsOutOfRange) {
+    EXPECT_EQ(FloatADC(0.5f).readCode(), 2048);
+    EXPECT_EQ(FloatADC(-0.2f).readCode(), 0);
+    EXPECT_EQ(FloatADC(1.7f).readCode(), 4095);
+    EXPECT_EQ(FloatADC(std::numeric_limits<float>::quiet_NaN()).readCode(), 0);
+}
+
+TEST(SampleRingTest, ReadBlock_WrapsAndPreservesOrder) {
+    SampleRing<int, 8> ring;
+    int out[8];
+    for (int i = 0; i < 6; ++i) ring.push(i);
+    EXPECT_EQ(ring.readBlock(out, 4), 4u);
+    for (int i = 6; i < 12; ++i) EXPECT_TRUE(ring.push(i));
+
+    ASSERT_EQ(ring.available(), 8u);
+    ASSERT_EQ(ring.readBlock(out, 8), 8u);
+    for (int i = 0; i < 8; ++i) EXPECT_EQ(out[i], i + 4);
+    EXPECT_EQ(ring.readBlock(out, 8), 0u);
+}
+
+TEST(SampleRingTest, Push_WhenFull_DropsAndCounts) {
+    SampleRing<int, 4> ring;
+    for (int i = 0; i < 6; ++i) ring.push(i);
+    EXPECT_EQ(ring.available(), 4u);
+    EXPECT_EQ(ring.dropped(), 2u);
+    int out[4];
+    ring.readBlock(out, 4);
+    EXPECT_EQ(out[0], 0);
+    EXPECT_EQ(out[3], 3);
+}
+
+TEST(SampleRingTest, ConcurrentProducer_DeliversEveryItemInOrder) {
+    SampleRing<uint32_t, 256> ring;
+    const uint32_t total = 100000;
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < total;) {
+            if (ring.push(i)) ++i;
+            else std::this_thread::yield();
+        }
+    });
+    uint32_t expected = 0;
+    uint32_t block[64];
+    while (expected < total) {
+        size_t n = ring.readBlock(block, 64);
+        if (n == 0) std::this_thread::yield();
+        for (size_t i = 0; i < n; ++i) ASSERT_EQ(block[i], expected++);
+    }
+    producer.join();
+    EXPECT_EQ(ring.available(), 0u);
+}
+
+TEST(ThreadedAcquisitionTest, SamplesAtConfiguredRate) {
+    SimulatedVaneADC adc;
+    adc.setAngle(90.0f);
+    ThreadedAcquisition acq(adc, 1000);
+    ASSERT_TRUE(acq.start());
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    acq.stop();
+    EXPECT_FALSE(acq.running());
+
+    std::vector<AcquiredSample> samples(AcquisitionBase::kRingCapacity);
+    samples.resize(acq.readBlock(samples.data(), samples.size()));
+    // Loose bounds: CI hosts can deschedule the sampler
+    ASSERT_GT(samples.size(), 100u);
+    EXPECT_LT(samples.size(), 260u);
+    for (size_t i = 1; i < samples.size(); ++i)
+        EXPECT_GT(samples[i].timestampUs, samples[i - 1].timestampUs);
+    const double spanUs = samples.back().timestampUs - samples.front().timestampUs;
+    EXPECT_NEAR(spanUs / (samples.size() - 1), 1000.0, 300.0);
+}
+
+TEST(ThreadedAcquisitionTest, AcquisitionADC_ReturnsNewestSample) {
+    SimulatedVaneConfig cfg;
+    cfg.noiseCodes = 0.0f;
+    cfg.bounceSamples = 0;
+    SimulatedVaneADC adc(cfg);
+    adc.setAngle(180.0f);
+    ThreadedAcquisition acq(adc, 2000);
+    AcquisitionADC buffered(acq);
+    acq.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(buffered.readCode(), adc.idealCode(180.0f));
+    EXPECT_EQ(acq.available(), 0u);
+    acq.stop();
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include "WindVane/IADC.h"
+#include "WindVane/Calibration/SpinningMethod.h"
+#include "WindVane/Diagnostics/IDiagnostics.h"
+#include "WindVane/Storage/ICalibrationStorage.h"
+#include "test_doubles.h"
+
+// Counts every global heap allocation so the steady-state calibration and
+// mapping paths can be checked for zero allocations.
+namespace {
+std::atomic<size_t> gAllocations{0};
+}
+
+void* operator new(std::size_t size) {
+    ++gAllocations;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+using namespace testing;
+
+namespace {
+
+using doubles::DetentADC;
+
+constexpr int kPositions = 16;
+constexpr int kSamplesPerDetent = 8;
+
+class ReservedStorage : public ICalibrationStorage {
+public:
+    ReservedStorage() { _saved.reserve(ClusterManager::kCapacity); }
+
+    StorageResult save(const std::vector<ClusterData>& clusters, int version) override {
+        _saved.assign(clusters.begin(), clusters.end());
+        _version = version;
+        ++saves;
+        return {};
+    }
+    StorageResult load(std::vector<ClusterData>&, int&) override {
+        return {StorageStatus::IoError, {}};
+    }
+    int getSchemaVersion() const override { return _version; }
+    StorageResult clear() override { return {}; }
+
+    int saves{0};
+
+private:
+    std::vector<ClusterData> _saved;
+    int _version{0};
+};
+
+class CountingDiagnostics : public IDiagnostics {
+public:
+    void info(const char*) override { ++infos; }
+    void warn(const char*) override { ++warns; }
+
+    int infos{0};
+    int warns{0};
+};
+
+} // namespace
+
+TEST(AllocationFreeTest, CalibrationAndMapping_DoNotAllocate) {
+    DetentADC adc(kPositions, kSamplesPerDetent);
+    ReservedStorage storage;
+    CountingDiagnostics diag;
+    SpinningConfig cfg;
+    cfg.expectedPositions = kPositions;
+    cfg.sampleDelayMs = 0;
+    SpinningMethod method({adc, storage, diag, cfg});
+
+    const size_t before = gAllocations.load();
+
+    method.calibrate();
+    float sink = 0.0f;
+    for (int i = 0; i < 1000000; ++i)
+        sink += method.mapReading(static_cast<float>(i % 4096) / 4095.0f);
+
+    EXPECT_EQ(gAllocations.load() - before, 0u);
+    EXPECT_EQ(storage.saves, 1);
+    EXPECT_GT(diag.infos, kPositions);
+    EXPECT_GT(sink, 0.0f);
+}
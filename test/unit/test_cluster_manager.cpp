@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "WindVane/Calibration/ClusterManager.h"
+
+using namespace testing;
+
+namespace {
+
+std::vector<ClusterData> makeProfile(int positions, float offset) {
+    std::vector<ClusterData> clusters;
+    for (int i = 0; i < positions; ++i) {
+        float mean = offset + static_cast<float>(i) / positions;
+        if (mean >= 1.0f) mean -= 1.0f;
+        clusters.push_back({mean, mean - 0.001f, mean + 0.001f, 10});
+    }
+    return clusters;
+}
+
+} // namespace
+
+class ClusterManagerTest : public Test {
+protected:
+    BasicClusterManager<360> manager;
+};
+
+TEST_F(ClusterManagerTest, SetClusters_CompilesLookupTable) {
+    EXPECT_FALSE(manager.hasLookup());
+    manager.setClusters(makeProfile(16, 0.03f));
+    EXPECT_TRUE(manager.hasLookup());
+}
+
+TEST_F(ClusterManagerTest, Lookup_EveryAdcCode_MatchesLinearScan) {
+    for (int positions : {1, 8, 16, 64, 360}) {
+        manager.setClusters(makeProfile(positions, 0.017f));
+        for (size_t code = 0; code < ClusterManagerBase::kLookupSize; ++code) {
+            float reading = code / 4095.0f;
+            ASSERT_EQ(manager.lookup(static_cast<uint16_t>(code)),
+                      manager.interpolateScan(reading)) << "code " << code;
+            ASSERT_EQ(manager.interpolate(reading), manager.interpolateScan(reading));
+        }
+    }
+}
+
+TEST_F(ClusterManagerTest, AddOrUpdate_InvalidatesLookupUntilMerge) {
+    manager.setClusters(makeProfile(8, 0.05f));
+    manager.addOrUpdate(0.5f, 0.05f);
+    EXPECT_FALSE(manager.hasLookup());
+    EXPECT_EQ(manager.interpolate(0.3f), manager.interpolateScan(0.3f));
+
+    manager.mergeAndPrune(0.075f, 2);
+    EXPECT_TRUE(manager.hasLookup());
+}
+
+TEST_F(ClusterManagerTest, Interpolate_OutOfRangeReading_FallsBackToScan) {
+    manager.setClusters(makeProfile(16, 0.0f));
+    EXPECT_EQ(manager.interpolate(1.25f), manager.interpolateScan(1.25f));
+    EXPECT_EQ(manager.interpolate(-0.1f), manager.interpolateScan(-0.1f));
+}
+
+TEST_F(ClusterManagerTest, InterpolateBatch_MatchesScalarPathExactly) {
+    manager.setClusters(makeProfile(16, 0.021f));
+    std::vector<float> readings;
+    for (int i = 0; i <= 10000; ++i)
+        readings.push_back(i / 10000.0f);
+    std::vector<float> degrees(readings.size());
+
+    manager.interpolateBatch(readings.data(), degrees.data(), readings.size());
+
+    for (size_t i = 0; i < readings.size(); ++i)
+        ASSERT_EQ(degrees[i], manager.interpolate(readings[i])) << "reading " << readings[i];
+}
+
+TEST_F(ClusterManagerTest, InterpolateBatch_ArbitraryReadings_WithinOneCodeOfScan) {
+    manager.setClusters(makeProfile(16, 0.021f));
+    std::vector<float> readings;
+    for (int i = 0; i < 10000; ++i)
+        readings.push_back((i + 0.37f) / 10000.0f);
+    std::vector<float> degrees(readings.size());
+
+    manager.interpolateBatch(readings.data(), degrees.data(), readings.size());
+
+    // Quantizing to 12-bit codes moves a reading by at most half a code,
+    // i.e. 0.044 degrees for evenly spaced detents.
+    for (size_t i = 0; i < readings.size(); ++i) {
+        float diff = std::fabs(degrees[i] - manager.interpolateScan(readings[i]));
+        ASSERT_LT(std::min(diff, 360.0f - diff), 0.05f);
+    }
+}
+
+TEST_F(ClusterManagerTest, InterpolateBatch_OutOfRangeReadings_AreClamped) {
+    manager.setClusters(makeProfile(16, 0.0f));
+    const float readings[] = {-0.5f, 1.5f};
+    float degrees[2];
+    manager.interpolateBatch(readings, degrees, 2);
+    EXPECT_EQ(degrees[0], manager.lookup(0));
+    EXPECT_EQ(degrees[1], manager.lookup(4095));
+}
+
+TEST_F(ClusterManagerTest, MergeAndPrune_CompactsInPlace) {
+    const float readings[] = {0.10f, 0.11f, 0.50f, 0.12f, 0.90f, 0.52f};
+    for (float r : readings)
+        manager.addOrUpdate(r, 0.005f);
+    ASSERT_EQ(manager.clusters().size(), 6u);
+
+    manager.mergeAndPrune(0.03f, 2);
+
+    ASSERT_EQ(manager.clusters().size(), 2u);
+    EXPECT_NEAR(manager.clusters()[0].mean, 0.11f, 1e-6f);
+    EXPECT_EQ(manager.clusters()[0].count, 3);
+    EXPECT_NEAR(manager.clusters()[1].mean, 0.51f, 1e-6f);
+}
+
+TEST_F(ClusterManagerTest, AddOrUpdate_BeyondCapacity_CountsOverflow) {
+    BasicClusterManager<4> small;
+    for (int i = 0; i < 6; ++i)
+        small.addOrUpdate(0.1f + i * 0.1f, 0.01f);
+    EXPECT_EQ(small.clusters().size(), 4u);
+    EXPECT_EQ(small.overflows(), 2);
+    EXPECT_FALSE(small.setClusters(makeProfile(8, 0.0f)));
+    EXPECT_EQ(small.clusters().size(), 4u);
+}
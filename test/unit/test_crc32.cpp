@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <algorithm>
+#include <fstream>
+#include <vector>
+#include "WindVane/Storage/Crc32.h"
+#include "WindVane/Storage/FileCalibrationStorage.h"
+#include "WindVane/Storage/FileSettingsStorage.h"
+
+using namespace testing;
+
+namespace {
+
+// Reference bit-at-a-time CRC, as the storage code computed it before tables
+uint32_t bitwiseCrc(uint32_t poly, const unsigned char* data, size_t len) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= data[i];
+        for (int j = 0; j < 8; ++j)
+            crc = (crc & 1) ? (crc >> 1) ^ poly : crc >> 1;
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+std::vector<unsigned char> pattern(size_t len) {
+    std::vector<unsigned char> data(len);
+    uint32_t x = 0x12345678u;
+    for (auto& b : data) {
+        x = x * 1664525u + 1013904223u;
+        b = static_cast<unsigned char>(x >> 24);
+    }
+    return data;
+}
+
+} // namespace
+
+TEST(Crc32Test, KnownCheckValues) {
+    const char* check = "123456789";
+    EXPECT_EQ(Crc32::compute(CrcKind::Ieee, check, 9), 0xCBF43926u);
+    EXPECT_EQ(Crc32::compute(CrcKind::Castagnoli, check, 9), 0xE3069283u);
+    EXPECT_EQ(Crc32::compute(CrcKind::Ieee, check, 0), 0u);
+}
+
+TEST(Crc32Test, MatchesBitwiseReferenceForAllLengths) {
+    const auto data = pattern(257);
+    for (size_t len = 0; len <= data.size(); ++len) {
+        ASSERT_EQ(Crc32::compute(CrcKind::Ieee, data.data(), len),
+                  bitwiseCrc(0xEDB88320u, data.data(), len)) << len;
+        ASSERT_EQ(Crc32::compute(CrcKind::Castagnoli, data.data(), len),
+                  bitwiseCrc(0x82F63B78u, data.data(), len)) << len;
+    }
+}
+
+TEST(Crc32Test, HardwarePathMatchesPortable) {
+    const auto data = pattern(1021);
+    const uint32_t portable =
+        Crc32::updatePortable(CrcKind::Castagnoli, 0xFFFFFFFFu, data.data() + 3, 1013) ^ 0xFFFFFFFFu;
+    EXPECT_EQ(Crc32::compute(CrcKind::Castagnoli, data.data() + 3, 1013), portable);
+}
+
+TEST(Crc32Test, StreamingUpdateMatchesOneShot) {
+    const auto data = pattern(500);
+    for (CrcKind kind : {CrcKind::Ieee, CrcKind::Castagnoli}) {
+        Crc32 crc(kind);
+        size_t pos = 0, step = 1;
+        while (pos < data.size()) {
+            size_t n = std::min(step, data.size() - pos);
+            crc.update(data.data() + pos, n);
+            pos += n;
+            step = step * 3 % 17 + 1;
+        }
+        EXPECT_EQ(crc.value(), Crc32::compute(kind, data.data(), data.size()));
+        crc.reset();
+        EXPECT_EQ(crc.value(), 0u);
+    }
+}
+
+TEST(Crc32Test, VersionFlagSelectsChecksum) {
+    EXPECT_EQ(crcKindForVersion(3), CrcKind::Ieee);
+    EXPECT_EQ(crcKindForVersion(storedVersion(3)), CrcKind::Castagnoli);
+    EXPECT_EQ(schemaVersion(storedVersion(3)), 3);
+}
+
+TEST(Crc32Test, LegacyCalibrationFileStillLoads) {
+    const std::string path = "crc_legacy_calibration.bin";
+    std::vector<ClusterData> clusters(4);
+    for (size_t i = 0; i < clusters.size(); ++i) {
+        clusters[i].mean = 0.2f * i;
+        clusters[i].min = clusters[i].mean - 0.01f;
+        clusters[i].max = clusters[i].mean + 0.01f;
+        clusters[i].count = 10;
+    }
+    CalibrationStorageHeader hdr{};
+    hdr.version = 2;
+    hdr.timestamp = 1;
+    hdr.count = static_cast<uint16_t>(clusters.size());
+    hdr.crc = bitwiseCrc(0xEDB88320u, reinterpret_cast<const unsigned char*>(clusters.data()),
+                         clusters.size() * sizeof(ClusterData));
+    {
+        std::ofstream ofs(path, std::ios::binary);
+        ofs.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+        ofs.write(reinterpret_cast<const char*>(clusters.data()),
+                  clusters.size() * sizeof(ClusterData));
+    }
+    FileCalibrationStorage storage(path);
+    std::vector<ClusterData> loaded;
+    int version = 0;
+    EXPECT_TRUE(storage.load(loaded, version).ok());
+    EXPECT_EQ(version, 2);
+    ASSERT_EQ(loaded.size(), clusters.size());
+
+    // Saved files carry the flag and round-trip with CRC-32C
+    EXPECT_TRUE(storage.save(clusters, 2).ok());
+    EXPECT_TRUE(storage.load(loaded, version).ok());
+    EXPECT_EQ(version, 2);
+    EXPECT_EQ(storage.getSchemaVersion(), 2);
+    std::remove(path.c_str());
+    std::remove((path + ".bak").c_str());
+}
+
+TEST(Crc32Test, LegacySettingsFileStillLoads) {
+    const std::string path = "crc_legacy_settings.bin";
+    SettingsData data{};
+    data.spin.expectedPositions = 32;
+    SettingsStorageHeader hdr{};
+    hdr.version = 1;
+    hdr.crc = bitwiseCrc(0xEDB88320u, reinterpret_cast<const unsigned char*>(&data), sizeof(data));
+    {
+        std::ofstream ofs(path, std::ios::binary);
+        ofs.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+        ofs.write(reinterpret_cast<const char*>(&data), sizeof(data));
+    }
+    FileSettingsStorage storage(path);
+    SettingsData loaded{};
+    EXPECT_TRUE(storage.load(loaded).ok());
+    EXPECT_EQ(loaded.spin.expectedPositions, 32);
+    EXPECT_EQ(storage.getSchemaVersion(), 1);
+
+    // Corrupting a byte is still caught under the new checksum
+    EXPECT_TRUE(storage.save(loaded).ok());
+    {
+        std::fstream fs(path, std::ios::binary | std::ios::in | std::ios::out);
+        fs.seekp(sizeof(hdr));
+        fs.put('\x5A');
+    }
+    EXPECT_EQ(storage.load(loaded).status, StorageStatus::CorruptData);
+    std::remove(path.c_str());
+}
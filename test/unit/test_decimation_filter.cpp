@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "WindVane/Acquisition/DecimationFilter.h"
+#include "WindVane/Acquisition/FilteredADC.h"
+#include "WindVane/Drivers/SimulatedVaneADC.h"
+
+using namespace testing;
+
+namespace {
+
+class ConstantADC : public IADC {
+public:
+    explicit ConstantADC(uint16_t code) : _code(code) {}
+    float read() const override { return _code / 4095.0f; }
+    uint16_t readCode() const override { ++reads; return _code; }
+    mutable int reads{0};
+
+private:
+    uint16_t _code;
+};
+
+// Alternates between two adjacent codes, so only an oversampled
+// reading can resolve the midpoint.
+class DitherADC : public IADC {
+public:
+    float read() const override { return readCode() / 4095.0f; }
+    uint16_t readCode() const override { return (_n++ & 1) ? 2001 : 2000; }
+
+private:
+    mutable uint32_t _n{0};
+};
+
+double stddev(const std::vector<double>& v) {
+    double mean = 0.0;
+    for (double x : v) mean += x;
+    mean /= v.size();
+    double var = 0.0;
+    for (double x : v) var += (x - mean) * (x - mean);
+    return std::sqrt(var / v.size());
+}
+
+} // namespace
+
+TEST(DecimationFilterTest, Cic_ConstantInput_GainIsDecimationToTheOrder) {
+    DecimationFilter filter({FilterType::CIC, 8, 8, 3});
+    EXPECT_EQ(filter.gain(), 512u);
+    int outputs = 0;
+    for (int i = 0; i < 64; ++i) outputs += filter.push(1234);
+    EXPECT_EQ(outputs, 8);
+    EXPECT_TRUE(filter.settled());
+    EXPECT_EQ(filter.output(), 1234u * 512u);
+    EXPECT_EQ(filter.outputCode(), 1234);
+}
+
+TEST(DecimationFilterTest, Cic_LimitsOrderToRegisterWidth) {
+    DecimationFilter filter({FilterType::CIC, 256, 8, 4});
+    EXPECT_EQ(filter.config().order, 2);
+    for (int i = 0; i < 256 * 4; ++i) filter.push(4095);
+    EXPECT_EQ(filter.outputCode(), 4095);
+}
+
+TEST(DecimationFilterTest, MovingAverage_OverlappingWindow) {
+    DecimationFilter filter({FilterType::MovingAverage, 2, 4, 1});
+    std::vector<float> out(8);
+    const uint16_t codes[] = {0, 0, 0, 0, 4095, 4095, 4095, 4095};
+    ASSERT_EQ(filter.process(codes, 8, out.data()), 4u);
+    EXPECT_FLOAT_EQ(out[1], 0.0f);
+    EXPECT_FLOAT_EQ(out[2], 0.5f);
+    EXPECT_FLOAT_EQ(out[3], 1.0f);
+}
+
+TEST(DecimationFilterTest, Oversampling_ResolvesBelowOneCode) {
+    DitherADC adc;
+    FilteredADC filtered(adc, {FilterType::MovingAverage, 16, 16, 1});
+    EXPECT_NEAR(filtered.read() * 4095.0f, 2000.5f, 0.01f);
+}
+
+TEST(DecimationFilterTest, FilteredADC_ConsumesDecimationSamplesPerRead) {
+    ConstantADC adc(100);
+    FilteredADC filtered(adc, {FilterType::CIC, 4, 4, 2});
+    EXPECT_EQ(filtered.readCode(), 100);
+    EXPECT_EQ(adc.reads, 8);  // first read flushes order * decimation samples
+    filtered.readCode();
+    EXPECT_EQ(adc.reads, 12);
+}
+
+TEST(DecimationFilterTest, FilteredADC_ReducesNoise) {
+    SimulatedVaneConfig cfg;
+    cfg.noiseCodes = 8.0f;
+    cfg.bounceSamples = 0;
+    SimulatedVaneADC raw(cfg);
+    raw.setAngle(90.0f);
+    FilteredADC filtered(raw, {FilterType::CIC, 16, 16, 2});
+
+    std::vector<double> rawSamples, filteredSamples;
+    for (int i = 0; i < 2000; ++i) rawSamples.push_back(raw.readCode());
+    for (int i = 0; i < 500; ++i) filteredSamples.push_back(filtered.read() * 4095.0);
+    EXPECT_LT(stddev(filteredSamples), stddev(rawSamples) / 2.0);
+}
@@ -0,0 +1,310 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "WindVane/Diagnostics/BufferedDiagnostics.h"
+#include "WindVane/Diagnostics/DiagnosticsBus.h"
+
+using namespace testing;
+
+namespace {
+
+class RecordingSink : public IDiagnosticsSink {
+public:
+    void handle(const DiagnosticsEvent& ev) override { events.push_back(ev); }
+    std::vector<DiagnosticsEvent> events;
+};
+
+// Checks per-producer ordering; producer id and sequence ride in the args
+class OrderingSink : public IDiagnosticsSink {
+public:
+    static constexpr int kProducers = 4;
+    void handle(const DiagnosticsEvent& ev) override {
+        if (!ev.format) return;
+        if (ev.argCount != 2) { ++warnings; return; }
+        const int producer = ev.args[0].i;
+        const int seq = ev.args[1].i;
+        if (seq <= last[producer]) ordered = false;
+        last[producer] = seq;
+        ++received;
+    }
+    int last[kProducers] = {-1, -1, -1, -1};
+    std::atomic<int> received{0};
+    int warnings{0};
+    bool ordered{true};
+};
+
+class LineOutput : public IOutput {
+public:
+    void write(const char* text) const override { _pending += text; }
+    void writeln(const char* text) const override {
+        lines.push_back(_pending + text);
+        _pending.clear();
+    }
+    void clear() const override {}
+    mutable std::vector<std::string> lines;
+
+private:
+    mutable std::string _pending;
+};
+
+class TextDiagnostics : public IDiagnostics {
+public:
+    void info(const char* msg) override { lines.push_back(std::string("I ") + msg); }
+    void warn(const char* msg) override { lines.push_back(std::string("W ") + msg); }
+    std::vector<std::string> lines;
+};
+
+std::string rendered(const DiagnosticsEvent& ev) {
+    char buf[128];
+    ev.render(buf, sizeof(buf));
+    return buf;
+}
+
+} // namespace
+
+static_assert(std::is_trivially_copyable<DiagnosticsEvent>::value,
+              "events must be copyable into queues and rings by value");
+
+TEST(DiagnosticsEventTest, Structured_RendersTypedArguments) {
+    auto ev = DiagnosticsEvent::structured(LogLevel::Info, "Cluster %u: mean=%.3f count=%d %s %x %%",
+                                           7u, 0.4375f, -3, "ok", 255u);
+    EXPECT_EQ(rendered(ev), "Cluster 7: mean=0.438 count=-3 ok ff %");
+}
+
+TEST(DiagnosticsEventTest, Structured_IgnoresLengthModifiersAndMissingArgs) {
+    auto ev = DiagnosticsEvent::structured(LogLevel::Warn, "%lu of %zu then %d", 3ul, size_t{9});
+    EXPECT_EQ(rendered(ev), "3 of 9 then ");
+}
+
+TEST(DiagnosticsEventTest, Render_TruncatesToBuffer) {
+    auto ev = DiagnosticsEvent::structured(LogLevel::Info, "value=%d and more", 123456);
+    char buf[10];
+    EXPECT_EQ(ev.render(buf, sizeof(buf)), 9u);
+    EXPECT_STREQ(buf, "value=123");
+}
+
+TEST(DiagnosticsEventTest, Plain_CopiesAndTruncatesText) {
+    std::string longText(200, 'x');
+    auto ev = DiagnosticsEvent::plain(LogLevel::Info, longText.c_str());
+    EXPECT_EQ(rendered(ev).size(), DiagnosticsEvent::kTextSize - 1);
+}
+
+TEST(DiagnosticsEventTest, CharConversion_SubstitutesForMissingCharacter) {
+    auto ev = DiagnosticsEvent::structured(LogLevel::Info, "[%c] [%c] end", "str", 'k');
+    EXPECT_EQ(rendered(ev), "[?] [k] end");
+}
+
+TEST(DiagnosticsBusTest, SynchronousPlainText_IsNotTruncated) {
+    DiagnosticsBus bus;
+    const std::string longText(100, 'y');
+    std::string seen;
+    struct CaptureSink : IDiagnosticsSink {
+        std::string* out;
+        void handle(const DiagnosticsEvent& ev) override { *out = ev.plainText(); }
+    } capture;
+    capture.out = &seen;
+    bus.addSink(&capture);
+    bus.info(longText.c_str());
+    EXPECT_EQ(seen, longText);
+
+    // Queued events cannot borrow the caller's string
+    bus.enableQueue();
+    bus.info(longText.c_str());
+    bus.drain();
+    EXPECT_EQ(seen.size(), DiagnosticsEvent::kTextSize - 1);
+}
+
+TEST(DiagnosticsBusTest, Infof_DefersFormattingToSinks) {
+    DiagnosticsBus bus;
+    RecordingSink sink;
+    bus.addSink(&sink);
+    static const char kFormat[] = "Position detected: %u/%d";
+    bus.infof(kFormat, 3u, 8);
+    bus.warn("plain");
+
+    ASSERT_EQ(sink.events.size(), 2u);
+    EXPECT_EQ(sink.events[0].format, kFormat);  // the format id survives
+    EXPECT_EQ(sink.events[0].argCount, 2);
+    EXPECT_EQ(rendered(sink.events[0]), "Position detected: 3/8");
+    EXPECT_EQ(sink.events[1].level, LogLevel::Warn);
+    EXPECT_EQ(rendered(sink.events[1]), "plain");
+}
+
+TEST(DiagnosticsBusTest, DefaultLog_RendersForTextOnlyImplementations) {
+    TextDiagnostics diag;
+    diag.warnf("clusters %u and %u far apart", 1u, 2u);
+    ASSERT_EQ(diag.lines.size(), 1u);
+    EXPECT_EQ(diag.lines[0], "W clusters 1 and 2 far apart");
+}
+
+TEST(DiagnosticsBusTest, Queue_CountsDropsAndReportsThemInBand) {
+    DiagnosticsBus bus;
+    RecordingSink sink;
+    bus.addSink(&sink);
+    bus.enableQueue();
+    for (int i = 0; i < 100; ++i) bus.infof("event %d", i);
+    EXPECT_TRUE(sink.events.empty());
+    EXPECT_EQ(bus.dropped(), 100u - DiagnosticsBus::kQueueCapacity);
+
+    EXPECT_EQ(bus.drain(), DiagnosticsBus::kQueueCapacity);
+    ASSERT_EQ(sink.events.size(), DiagnosticsBus::kQueueCapacity + 1);
+    EXPECT_EQ(rendered(sink.events.front()), "event 0");
+    EXPECT_EQ(sink.events.back().level, LogLevel::Warn);
+    EXPECT_EQ(rendered(sink.events.back()), "Diagnostics queue dropped 36 events");
+}
+
+TEST(DiagnosticsBusTest, Async_ManyProducers_DeliversInOrderAndFlushesOnStop) {
+    DiagnosticsBus bus;
+    OrderingSink sink;
+    bus.addSink(&sink);
+    bus.startAsync();
+    ASSERT_TRUE(bus.async());
+
+    constexpr int kPerProducer = 20000;
+    std::vector<std::thread> producers;
+    for (int p = 0; p < OrderingSink::kProducers; ++p) {
+        producers.emplace_back([&bus, p] {
+            for (int i = 0; i < kPerProducer; ++i) {
+                bus.infof("producer %d seq %d", p, i);
+                if ((i & 0x3F) == 0) std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& t : producers) t.join();
+    bus.stopAsync();
+    EXPECT_FALSE(bus.queued());
+
+    EXPECT_TRUE(sink.ordered);
+    EXPECT_EQ(static_cast<uint32_t>(sink.received) + bus.dropped(),
+              static_cast<uint32_t>(OrderingSink::kProducers * kPerProducer));
+    EXPECT_EQ(sink.warnings > 0, bus.dropped() > 0);
+
+    // Back to synchronous delivery
+    const int before = sink.received;
+    bus.infof("producer %d seq %d", 0, kPerProducer);
+    EXPECT_EQ(sink.received, before + 1);
+}
+
+TEST(DiagnosticsBusTest, Flush_WaitsForQueuedEvents) {
+    DiagnosticsBus bus;
+    RecordingSink sink;
+    bus.addSink(&sink);
+    bus.startAsync();
+    for (int i = 0; i < 10; ++i) bus.infof("event %d", i);
+    bus.flush();
+    EXPECT_EQ(sink.events.size(), 10u);
+    bus.stopAsync();
+}
+
+TEST(BufferedDiagnosticsTest, Ring_KeepsNewestInArrivalOrder) {
+    BufferedDiagnostics history(4);
+    DiagnosticsBus bus;
+    bus.addSink(&history);
+    for (int i = 0; i < 10; ++i) bus.infof("event %d", i);
+
+    ASSERT_EQ(history.size(), 4u);
+    EXPECT_STREQ(history.at(0).text, "event 6");
+    EXPECT_STREQ(history.at(3).text, "event 9");
+    history.clear();
+    EXPECT_EQ(history.size(), 0u);
+    bus.warn("after clear");
+    ASSERT_EQ(history.size(), 1u);
+    EXPECT_EQ(history.at(0).level, LogLevel::Warn);
+}
+
+TEST(BufferedDiagnosticsTest, Records_AreFixedSizeAndTruncated) {
+    static_assert(sizeof(DiagnosticsRecord) == 64, "one cache line per record");
+    BufferedDiagnostics history(2);
+    auto ev = DiagnosticsEvent::structured(LogLevel::Info, "%s %s %s", "a long message that",
+                                           "will not fit inside a single", "history record");
+    ev.timestamp = platform::TimeMs{1234};
+    history.handle(ev);
+    EXPECT_EQ(strlen(history.at(0).text), DiagnosticsRecord::kTextSize - 1);
+
+    char line[96];
+    history.at(0).format(line, sizeof(line));
+    EXPECT_EQ(std::string(line).rfind("[1234] INFO: a long message", 0), 0u);
+}
+
+TEST(BufferedDiagnosticsTest, Construction_ReportsMemoryAndEchoesFullLines) {
+    LineOutput out;
+    BufferedDiagnostics history(32, &out);
+    EXPECT_EQ(history.memoryBytes(), 32 * sizeof(DiagnosticsRecord));
+    ASSERT_EQ(out.lines.size(), 1u);
+    EXPECT_EQ(out.lines[0], "Diagnostics history: 32 records, 2048 bytes");
+
+    auto ev = DiagnosticsEvent::structured(LogLevel::Warn, "%s!", "0123456789012345678901234567890123456789012345678901234567890123456789");
+    history.handle(ev);
+    ASSERT_EQ(out.lines.size(), 2u);
+    EXPECT_NE(out.lines[1].find("6789!"), std::string::npos);
+
+    // Plain text is echoed whole, however long
+    const std::string longText(300, 'x');
+    history.handle(DiagnosticsEvent::borrowed(LogLevel::Info, longText.c_str()));
+    ASSERT_EQ(out.lines.size(), 3u);
+    EXPECT_NE(out.lines[2].find("] INFO: " + longText), std::string::npos);
+}
+
+TEST(DiagnosticsLevelTest, BelowCompileTimeMinimum_ArgumentsAreNotEvaluated) {
+    static_assert(kMinLogLevel == LogLevel::Info, "unit tests build with the default level");
+    DiagnosticsBus bus;
+    RecordingSink sink;
+    bus.addSink(&sink);
+    int evaluated = 0;
+    auto touch = [&evaluated] { return ++evaluated; };
+    WINDVANE_LOG_DEBUG(bus, "debug %d", touch());
+    WINDVANE_LOG_INFO(bus, "info %d", touch());
+    EXPECT_EQ(evaluated, 1);
+    ASSERT_EQ(sink.events.size(), 1u);
+    EXPECT_EQ(rendered(sink.events[0]), "info 1");
+}
+
+TEST(DiagnosticsLevelTest, NoSinkAtLevel_SkipsArgumentEvaluation) {
+    DiagnosticsBus bus;
+    RecordingSink console;
+    bus.addSink(&console, levelsFrom(LogLevel::Warn));
+    int evaluated = 0;
+    auto touch = [&evaluated] { return ++evaluated; };
+    WINDVANE_LOG_INFO(bus, "info %d", touch());
+    EXPECT_EQ(evaluated, 0);
+    WINDVANE_LOG_ERROR(bus, "error %d", touch());
+    EXPECT_EQ(evaluated, 1);
+    EXPECT_FALSE(bus.enabled(LogLevel::Info));
+}
+
+TEST(DiagnosticsLevelTest, PerSinkMasks_RouteLevelsIndependently) {
+    DiagnosticsBus bus;
+    RecordingSink console, file;
+    bus.addSink(&console);
+    bus.addSink(&file);
+    bus.setSinkLevel(&console, LogLevel::Warn);
+    bus.debug("trace");
+    bus.info("note");
+    bus.warn("careful");
+    bus.errorf("failed %d", 2);
+
+    ASSERT_EQ(console.events.size(), 2u);
+    EXPECT_EQ(console.events[0].level, LogLevel::Warn);
+    EXPECT_EQ(console.events[1].level, LogLevel::Error);
+    ASSERT_EQ(file.events.size(), 4u);
+    EXPECT_EQ(file.events[0].level, LogLevel::Debug);
+
+    // Only the error level for the file sink
+    bus.setSinkLevels(&file, levelBit(LogLevel::Error));
+    bus.warn("careful");
+    EXPECT_EQ(file.events.size(), 4u);
+    EXPECT_EQ(console.events.size(), 3u);
+}
+
+TEST(DiagnosticsLevelTest, DefaultLog_MapsNewLevelsOntoInfoAndWarn) {
+    TextDiagnostics diag;
+    diag.debug("d");
+    diag.error("e");
+    ASSERT_EQ(diag.lines.size(), 2u);
+    EXPECT_EQ(diag.lines[0], "I d");
+    EXPECT_EQ(diag.lines[1], "W e");
+}
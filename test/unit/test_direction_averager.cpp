@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "WindVane/Processing/DirectionAverager.h"
+
+using namespace testing;
+using platform::TimeMs;
+
+namespace {
+
+float angularError(float a, float b) {
+    float d = std::fabs(a - b);
+    return d > 180.0f ? 360.0f - d : d;
+}
+
+} // namespace
+
+TEST(SineTableTest, MatchesLibraryAtEveryStep) {
+    for (uint16_t step = 0; step < circular::kSteps; ++step) {
+        double angle = 2.0 * M_PI * step / circular::kSteps;
+        EXPECT_NEAR(circular::sinStep(step), std::sin(angle) * circular::kOne, 1.0);
+        EXPECT_NEAR(circular::cosStep(step), std::cos(angle) * circular::kOne, 1.0);
+    }
+    static_assert(circular::sinStep(circular::kQuarter) == circular::kOne, "table peak");
+}
+
+TEST(DirectionAveragerTest, Mean_AcrossNorth_DoesNotWrapToSouth) {
+    DirectionAverager avg;
+    avg.add(350.0f, TimeMs{0});
+    avg.add(10.0f, TimeMs{1});
+    auto s = avg.stats();
+    EXPECT_EQ(s.samples, 2u);
+    EXPECT_LT(angularError(s.meanDeg, 0.0f), 0.5f);
+    EXPECT_NEAR(s.resultantLength, std::cos(10.0 * M_PI / 180.0), 1e-3);
+}
+
+TEST(DirectionAveragerTest, Add_IgnoresNonFiniteInput) {
+    DirectionAverager avg;
+    avg.add(std::nanf(""), TimeMs{0});
+    avg.add(INFINITY, TimeMs{1});
+    EXPECT_FALSE(avg.stats().valid());
+    avg.add(45.0f, TimeMs{2});
+    EXPECT_EQ(avg.stats().samples, 1u);
+}
+
+TEST(DirectionAveragerTest, Variance_SteadyVersusOpposed) {
+    DirectionAverager steady, opposed;
+    for (uint32_t t = 0; t < 100; ++t) {
+        steady.add(225.0f, TimeMs{t});
+        opposed.add(t % 2 ? 90.0f : 270.0f, TimeMs{t});
+    }
+    EXPECT_NEAR(steady.stats().meanDeg, 225.0f, 0.5f);
+    EXPECT_LT(steady.stats().variance, 1e-4f);
+    EXPECT_GT(opposed.stats().variance, 0.999f);
+}
+
+TEST(DirectionAveragerTest, Window_ExpiresOldBuckets) {
+    DirectionAverager avg(TimeMs{1000}, 10);
+    for (uint32_t t = 0; t < 1000; t += 10) avg.add(90.0f, TimeMs{t});
+    for (uint32_t t = 1000; t < 2000; t += 10) avg.add(180.0f, TimeMs{t});
+    auto s = avg.stats();
+    EXPECT_NEAR(s.meanDeg, 180.0f, 0.5f);
+    EXPECT_LE(s.samples, 100u);
+
+    avg.advance(TimeMs{60000});
+    EXPECT_FALSE(avg.stats().valid());
+}
+
+TEST(DirectionAveragerTest, LongWindow_HighRate_HasNoDrift) {
+    // Ten minutes at 1 kHz with buckets of ten seconds
+    DirectionAverager avg(TimeMs{600000}, 60);
+    for (uint32_t t = 0; t < 1200000; ++t)
+        avg.addCentidegrees(static_cast<uint16_t>(t % 2 ? 35900 : 100), TimeMs{t});
+    auto s = avg.stats();
+    EXPECT_GE(s.samples, 590000u);
+    EXPECT_LT(angularError(s.meanDeg, 0.0f), 0.01f);
+}
@@ -0,0 +1,346 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include "Config.h"
+#include "WindVane/Storage/EEPROMCalibrationStorage.h"
+#include "WindVane/Storage/EEPROMSettingsStorage.h"
+#include "WindVane/Storage/EepromIO.h"
+#include "WindVane/Storage/JournalSettingsStorage.h"
+#include "WindVane/Storage/EmulatedEeprom.h"
+
+using namespace testing;
+
+namespace {
+
+class FakePlatform : public IPlatform {
+public:
+    platform::TimeMs millis() const override { return platform::TimeMs{++_ms}; }
+    void renderStatusLine(MenuPresenter&, const WindVaneStatus&, const char*,
+                          const std::string&, MenuStatusLevel) const override {}
+    bool supportsColor() const override { return false; }
+
+private:
+    mutable uint32_t _ms{0};
+};
+
+std::vector<ClusterData> ladder(int n) {
+    std::vector<ClusterData> clusters(static_cast<size_t>(n));
+    for (int i = 0; i < n; ++i) {
+        const float mean = (i + 0.5f) / n;
+        clusters[static_cast<size_t>(i)] = {mean, mean - 0.01f, mean + 0.01f, 10 + i};
+    }
+    return clusters;
+}
+
+} // namespace
+
+class EmulatedEepromTest : public Test {
+protected:
+    void SetUp() override {
+        std::remove(kPath);
+        open();
+    }
+    void TearDown() override {
+        platform_factory::use_emulated_eeprom(nullptr);
+        _eeprom.reset();
+        std::remove(kPath);
+    }
+    // Simulates a reboot: RAM cache is gone, flash persists in the file
+    void open() {
+        platform_factory::use_emulated_eeprom(nullptr);
+        _eeprom.reset();
+        _eeprom = std::make_unique<EmulatedEeprom>(kPath);
+        ASSERT_TRUE(_eeprom->ok());
+        platform_factory::use_emulated_eeprom(_eeprom.get());
+        platform_factory::eeprom_reset_stats();
+    }
+
+    static constexpr const char* kPath = "emulated_eeprom.bin";
+    std::unique_ptr<EmulatedEeprom> _eeprom;
+};
+
+TEST_F(EmulatedEepromTest, FreshFlash_ReadsErased) {
+    ASSERT_TRUE(_eeprom->begin(16));
+    uint8_t buf[16];
+    _eeprom->read(0, buf, sizeof(buf));
+    for (uint8_t b : buf) EXPECT_EQ(b, 0xFF);
+}
+
+TEST_F(EmulatedEepromTest, CommitPersistsAndErasesSector) {
+    ASSERT_TRUE(_eeprom->begin(512));
+    const uint8_t data[4] = {1, 2, 3, 4};
+    _eeprom->write(100, data, sizeof(data));
+    EXPECT_TRUE(_eeprom->commit());
+    EXPECT_EQ(_eeprom->commits(), 1u);
+    EXPECT_EQ(_eeprom->erases(), 1u);
+    EXPECT_EQ(_eeprom->sectorErases(0), 1u);
+    // Nothing pending, nothing erased
+    EXPECT_TRUE(_eeprom->commit());
+    EXPECT_EQ(_eeprom->commits(), 1u);
+
+    open();
+    ASSERT_TRUE(_eeprom->begin(512));
+    uint8_t back[4] = {};
+    _eeprom->read(100, back, sizeof(back));
+    EXPECT_EQ(back[3], 4);
+}
+
+TEST_F(EmulatedEepromTest, UncommittedWrites_AreLostOnReboot) {
+    ASSERT_TRUE(_eeprom->begin(64));
+    const uint8_t v = 0x42;
+    _eeprom->write(0, &v, 1);
+    open();
+    ASSERT_TRUE(_eeprom->begin(64));
+    uint8_t back = 0;
+    _eeprom->read(0, &back, 1);
+    EXPECT_EQ(back, 0xFF);
+}
+
+TEST_F(EmulatedEepromTest, CalibrationStorage_RotatesSlotsAndSurvivesReboot) {
+    FakePlatform platform;
+    {
+        EEPROMCalibrationStorage storage(platform, 0, 512, 0, 4);
+        for (int n = 4; n <= 7; ++n)
+            ASSERT_TRUE(storage.save(ladder(n), 1).ok());
+    }
+    open();
+    EEPROMCalibrationStorage storage(platform, 0, 512, 0, 4);
+    std::vector<ClusterData> loaded;
+    int version = 0;
+    ASSERT_TRUE(storage.load(loaded, version).ok());
+    EXPECT_EQ(loaded.size(), 7u);
+    EXPECT_EQ(version, 1);
+}
+
+TEST_F(EmulatedEepromTest, CalibrationStorage_NewestSurvivesClockReset) {
+    {
+        // Long uptime, then a reboot restarts millis() from zero
+        FakePlatform platform;
+        for (int i = 0; i < 1000; ++i) platform.millis();
+        EEPROMCalibrationStorage storage(platform, 0, 512, 0, 4);
+        ASSERT_TRUE(storage.save(ladder(4), 1).ok());
+    }
+    open();
+    {
+        FakePlatform platform;
+        EEPROMCalibrationStorage storage(platform, 0, 512, 0, 4);
+        ASSERT_TRUE(storage.save(ladder(5), 1).ok());
+    }
+    open();
+    FakePlatform platform;
+    EEPROMCalibrationStorage storage(platform, 0, 512, 0, 4);
+    std::vector<ClusterData> loaded;
+    int version = 0;
+    ASSERT_TRUE(storage.load(loaded, version).ok());
+    EXPECT_EQ(loaded.size(), 5u);
+}
+
+TEST_F(EmulatedEepromTest, CalibrationStorage_ScansDirectoryOnce) {
+    FakePlatform platform;
+    EEPROMCalibrationStorage storage(platform, 0, 512, 0, 4);
+    ASSERT_TRUE(storage.save(ladder(4), 1).ok());
+    const uint32_t readsAfterScan = platform_factory::eeprom_stats().reads;
+    EXPECT_EQ(readsAfterScan, static_cast<uint32_t>(storage.slotCount()));
+
+    // Later saves and loads pick their slot from the RAM directory
+    platform_factory::eeprom_reset_stats();
+    for (int i = 0; i < 8; ++i)
+        ASSERT_TRUE(storage.save(ladder(4 + i % 3), 1).ok());
+    EXPECT_EQ(platform_factory::eeprom_stats().reads, 0u);
+    std::vector<ClusterData> loaded;
+    int version = 0;
+    ASSERT_TRUE(storage.load(loaded, version).ok());
+    EXPECT_EQ(platform_factory::eeprom_stats().reads, 2u);
+}
+
+TEST_F(EmulatedEepromTest, CalibrationStorage_ConfigurableSlotCount) {
+    FakePlatform platform;
+    {
+        EEPROMCalibrationStorage storage(platform, 0, 512, 0, 8);
+        EXPECT_EQ(storage.slotSize(), 64u);
+        for (int i = 0; i < 12; ++i)
+            ASSERT_TRUE(storage.save(ladder(1 + i % 3), 1).ok());
+        // 16-byte header plus 16-byte clusters: three fit, four do not
+        auto res = storage.save(ladder(4), 1);
+        EXPECT_EQ(res.status, StorageStatus::InvalidFormat);
+    }
+    open();
+    EEPROMCalibrationStorage storage(platform, 0, 512, 0, 8);
+    std::vector<ClusterData> loaded;
+    int version = 0;
+    ASSERT_TRUE(storage.load(loaded, version).ok());
+    EXPECT_EQ(loaded.size(), 3u);
+}
+
+TEST_F(EmulatedEepromTest, CalibrationStorage_CorruptNewestFallsBack) {
+    FakePlatform platform;
+    EEPROMCalibrationStorage storage(platform, 0, 512, 0, 4);
+    ASSERT_TRUE(storage.save(ladder(4), 1).ok());
+    ASSERT_TRUE(storage.save(ladder(6), 1).ok());
+
+    // Tear the second slot's payload as an interrupted write would
+    platform_factory::eeprom_begin(512);
+    const uint8_t junk[4] = {0xDE, 0xAD, 0xBE, 0xEF};
+    platform_factory::eeprom_write_bytes(storage.slotSize() + sizeof(CalibrationStorageHeader),
+                                         junk, sizeof(junk));
+    platform_factory::eeprom_commit();
+    platform_factory::eeprom_end();
+
+    std::vector<ClusterData> loaded;
+    int version = 0;
+    ASSERT_TRUE(storage.load(loaded, version).ok());
+    EXPECT_EQ(loaded.size(), 4u);
+}
+
+TEST_F(EmulatedEepromTest, CalibrationStorage_SaveAfterFallbackKeepsGoodSlot) {
+    const DeviceConfig cfg;
+    FakePlatform platform;
+    auto tearSlot = [&](const EEPROMCalibrationStorage& storage, int slot) {
+        platform_factory::eeprom_begin(cfg.eepromSize);
+        const uint8_t junk[4] = {0xDE, 0xAD, 0xBE, 0xEF};
+        platform_factory::eeprom_write_bytes(cfg.calibrationAddress + slot * storage.slotSize() +
+                                                 sizeof(CalibrationStorageHeader),
+                                             junk, sizeof(junk));
+        platform_factory::eeprom_commit();
+        platform_factory::eeprom_end();
+    };
+    {
+        EEPROMCalibrationStorage storage(platform, cfg.calibrationAddress, cfg.eepromSize,
+                                         calibrationRegionSize(cfg), cfg.calibrationSlots);
+        ASSERT_EQ(storage.slotCount(), 2);
+        ASSERT_TRUE(storage.save(ladder(4), 1).ok());
+        ASSERT_TRUE(storage.save(ladder(6), 1).ok());
+        tearSlot(storage, 1);
+
+        std::vector<ClusterData> loaded;
+        int version = 0;
+        ASSERT_TRUE(storage.load(loaded, version).ok());
+        ASSERT_EQ(loaded.size(), 4u);
+
+        // The next save must land on the torn slot; a power cut during it
+        // still leaves the fallback
+        ASSERT_TRUE(storage.save(ladder(8), 1).ok());
+        tearSlot(storage, 1);
+    }
+    open();
+    EEPROMCalibrationStorage storage(platform, cfg.calibrationAddress, cfg.eepromSize,
+                                     calibrationRegionSize(cfg), cfg.calibrationSlots);
+    std::vector<ClusterData> loaded;
+    int version = 0;
+    ASSERT_TRUE(storage.load(loaded, version).ok());
+    EXPECT_EQ(loaded.size(), 4u);
+}
+
+TEST_F(EmulatedEepromTest, CalibrationStorage_DefaultConfigHoldsSixteenPositions) {
+    const DeviceConfig cfg;
+    FakePlatform platform;
+    {
+        EEPROMCalibrationStorage storage(platform, cfg.calibrationAddress, cfg.eepromSize,
+                                         calibrationRegionSize(cfg), cfg.calibrationSlots);
+        ASSERT_TRUE(storage.layout().ok());
+        EXPECT_GE(storage.maxClusters(), 16u);
+        ASSERT_TRUE(storage.save(ladder(16), 1).ok());
+    }
+    open();
+    EEPROMCalibrationStorage storage(platform, cfg.calibrationAddress, cfg.eepromSize,
+                                     calibrationRegionSize(cfg), cfg.calibrationSlots);
+    std::vector<ClusterData> loaded;
+    int version = 0;
+    ASSERT_TRUE(storage.load(loaded, version).ok());
+    EXPECT_EQ(loaded.size(), 16u);
+}
+
+// Journal wraps and calibration fills every slot; neither may touch the other
+TEST_F(EmulatedEepromTest, DefaultConfig_CalibrationAndSettingsDoNotOverlap) {
+    const DeviceConfig cfg;
+    ASSERT_TRUE(eepromLayoutValid(cfg));
+    FakePlatform platform;
+    SettingsData settings{};
+    {
+        EEPROMCalibrationStorage calibration(platform, cfg.calibrationAddress, cfg.eepromSize,
+                                             calibrationRegionSize(cfg), cfg.calibrationSlots);
+        JournalSettingsStorage journal(cfg.settingsAddress, cfg.eepromSize, cfg.settingsSize);
+        EXPECT_LE(cfg.calibrationAddress +
+                      calibration.slotSize() * static_cast<size_t>(calibration.slotCount()),
+                  cfg.settingsAddress);
+        EXPECT_LE(journal.recordCapacity() * sizeof(JournalSettingsStorage::Record),
+                  cfg.settingsSize);
+        for (int i = 0; i < 3 * calibration.slotCount(); ++i) {
+            ASSERT_TRUE(calibration.save(ladder(16), 1).ok());
+            for (size_t n = 0; n < journal.recordCapacity(); ++n) {
+                settings.menuState = static_cast<PersistedMenuState>(n % 2);
+                ASSERT_TRUE(journal.save(settings).ok());
+            }
+        }
+    }
+    open();
+    EEPROMCalibrationStorage calibration(platform, cfg.calibrationAddress, cfg.eepromSize,
+                                         calibrationRegionSize(cfg), cfg.calibrationSlots);
+    JournalSettingsStorage journal(cfg.settingsAddress, cfg.eepromSize, cfg.settingsSize);
+    std::vector<ClusterData> loaded;
+    int version = 0;
+    ASSERT_TRUE(calibration.load(loaded, version).ok());
+    EXPECT_EQ(loaded.size(), 16u);
+    SettingsData reloaded{};
+    ASSERT_TRUE(journal.load(reloaded).ok());
+    EXPECT_EQ(reloaded.menuState, settings.menuState);
+}
+
+TEST_F(EmulatedEepromTest, CalibrationBlob_StaysInsideCalibrationRegion) {
+    const DeviceConfig cfg;
+    FakePlatform platform;
+    EEPROMCalibrationStorage calibration(platform, cfg.calibrationAddress, cfg.eepromSize,
+                                         calibrationRegionSize(cfg), cfg.calibrationSlots);
+    JournalSettingsStorage journal(cfg.settingsAddress, cfg.eepromSize, cfg.settingsSize);
+    SettingsData settings{};
+    settings.menuState = static_cast<PersistedMenuState>(1);
+    ASSERT_TRUE(journal.save(settings).ok());
+
+    std::vector<unsigned char> blob(calibrationRegionSize(cfg) + 1, 0xA5);
+    EXPECT_EQ(calibration.writeBlob(blob).status, StorageStatus::InvalidFormat);
+    blob.pop_back();
+    ASSERT_TRUE(calibration.writeBlob(blob).ok());
+
+    std::vector<unsigned char> back;
+    ASSERT_TRUE(calibration.readBlob(back).ok());
+    EXPECT_EQ(back, blob);
+    SettingsData reloaded{};
+    ASSERT_TRUE(JournalSettingsStorage(cfg.settingsAddress, cfg.eepromSize, cfg.settingsSize)
+                    .load(reloaded).ok());
+    EXPECT_EQ(reloaded.menuState, settings.menuState);
+}
+
+TEST_F(EmulatedEepromTest, CalibrationStorage_RejectsLayoutBeyondEeprom) {
+    FakePlatform platform;
+    EEPROMCalibrationStorage beyond(platform, 256, 512, 512);
+    EXPECT_EQ(beyond.layout().status, StorageStatus::InvalidFormat);
+    EXPECT_EQ(beyond.save(ladder(4), 1).status, StorageStatus::InvalidFormat);
+
+    // Eight slots in 128 bytes leave no room for a cluster after the header
+    EEPROMCalibrationStorage cramped(platform, 0, 128, 0, 8);
+    EXPECT_EQ(cramped.layout().status, StorageStatus::InvalidFormat);
+    std::vector<ClusterData> loaded;
+    int version = 0;
+    EXPECT_EQ(cramped.load(loaded, version).status, StorageStatus::InvalidFormat);
+}
+
+TEST_F(EmulatedEepromTest, UnchangedSettingsSave_SkipsWriteAndCommit) {
+    EEPROMSettingsStorage storage(256, 512);
+    SettingsData data{};
+    ASSERT_TRUE(storage.save(data).ok());
+    const auto first = platform_factory::eeprom_stats();
+    const uint32_t erases = _eeprom->erases();
+    EXPECT_EQ(first.commits, 1u);
+    EXPECT_GT(first.bytesWritten, 0u);
+
+    ASSERT_TRUE(storage.save(data).ok());
+    const auto second = platform_factory::eeprom_stats();
+    EXPECT_EQ(second.commits, 1u);
+    EXPECT_EQ(second.commitsSkipped, 1u);
+    EXPECT_EQ(second.bytesWritten, first.bytesWritten);
+    EXPECT_EQ(_eeprom->erases(), erases);
+
+    SettingsData loaded{};
+    ASSERT_TRUE(storage.load(loaded).ok());
+}
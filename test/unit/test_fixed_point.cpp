@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "WindVane/Calibration/ClusterManager.h"
+#include "WindVane/Calibration/FixedPoint.h"
+
+using namespace testing;
+
+namespace {
+
+constexpr float kToleranceDeg = 0.1f;
+
+float angularError(float a, float b) {
+    float diff = std::fabs(a - b);
+    return std::min(diff, 360.0f - diff);
+}
+
+std::vector<ClusterData> uniformProfile(int positions, float offset) {
+    std::vector<ClusterData> clusters;
+    for (int i = 0; i < positions; ++i) {
+        float mean = offset + static_cast<float>(i) / positions;
+        if (mean >= 1.0f) mean -= 1.0f;
+        clusters.push_back({mean, mean, mean, 5});
+    }
+    return clusters;
+}
+
+// Uneven resistor ladder: gaps vary by a factor of four around the circle.
+std::vector<ClusterData> ladderProfile(int positions) {
+    std::vector<ClusterData> clusters;
+    float total = 0.0f;
+    for (int i = 0; i < positions; ++i) total += 1.0f + (i % 4);
+    float mean = 0.02f;
+    for (int i = 0; i < positions; ++i) {
+        clusters.push_back({mean, mean, mean, 5});
+        mean += (1.0f + (i % 4)) / total * 0.96f;
+    }
+    return clusters;
+}
+
+} // namespace
+
+class FixedPointTest : public Test {
+protected:
+    ClusterManager manager;
+
+    void expectAgreesWithFloatPath() {
+        for (uint16_t code = 0; code <= fixed_point::kMaxCode; ++code) {
+            float reference = manager.interpolateScan(code / 4095.0f);
+            float fixedDeg = manager.interpolateCode(code) / 100.0f;
+            ASSERT_LT(angularError(fixedDeg, reference), kToleranceDeg) << "code " << code;
+            ASSERT_LT(angularError(manager.interpolate(code / 4095.0f), reference),
+                      kToleranceDeg) << "code " << code;
+        }
+    }
+};
+
+TEST_F(FixedPointTest, CodeToQ16_FullScaleMapsToOne) {
+    EXPECT_EQ(fixed_point::codeToQ16(0), 0u);
+    EXPECT_EQ(fixed_point::codeToQ16(4095), fixed_point::kQ16One);
+    EXPECT_EQ(fixed_point::codeToQ16(5000), fixed_point::kQ16One);
+}
+
+TEST_F(FixedPointTest, ToQ16_SaturatesBelowOne) {
+    EXPECT_EQ(fixed_point::toQ16(-0.5f), 0u);
+    EXPECT_EQ(fixed_point::toQ16(0.5f), 32768u);
+    EXPECT_EQ(fixed_point::toQ16(1.0f), 0xFFFFu);
+}
+
+TEST_F(FixedPointTest, SetClusters_StoresQ16Boundaries) {
+    manager.setClusters(uniformProfile(4, 0.125f));
+    ASSERT_EQ(manager.fixedClusters().size(), 4u);
+    EXPECT_EQ(manager.fixedClusters()[0].mean, 8192u);
+    EXPECT_EQ(manager.fixedClusters()[3].mean, 57344u);
+}
+
+TEST_F(FixedPointTest, NoClusters_AgreesWithFloatPath) {
+    expectAgreesWithFloatPath();
+}
+
+TEST_F(FixedPointTest, UniformProfiles_AgreeWithFloatPath) {
+    for (int positions : {8, 16, 32, 64}) {
+        manager.setClusters(uniformProfile(positions, 0.013f));
+        expectAgreesWithFloatPath();
+    }
+}
+
+TEST_F(FixedPointTest, WrappedFirstCluster_AgreesWithFloatPath) {
+    manager.setClusters(uniformProfile(16, 0.97f));
+    expectAgreesWithFloatPath();
+}
+
+TEST_F(FixedPointTest, UnevenLadder_AgreesWithFloatPath) {
+    manager.setClusters(ladderProfile(16));
+    expectAgreesWithFloatPath();
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "WindVane/Instrumentation/LatencyProbe.h"
+
+using namespace testing;
+
+TEST(LatencyHistogramTest, Buckets_AreMonotonicAndBoundValues) {
+    size_t prev = 0;
+    for (uint32_t us : {0u, 1u, 3u, 4u, 5u, 7u, 8u, 100u, 1000u, 65535u, 1000000u, 0xFFFFFFFFu}) {
+        size_t b = LatencyHistogram::bucketFor(us);
+        ASSERT_LT(b, LatencyHistogram::kBuckets);
+        EXPECT_GE(b, prev);
+        EXPECT_LE(us, LatencyHistogram::bucketUpperBound(b));
+        if (b > 0) {
+            EXPECT_GT(us, LatencyHistogram::bucketUpperBound(b - 1));
+        }
+        prev = b;
+    }
+}
+
+TEST(LatencyHistogramTest, Percentiles_TrackDistribution) {
+    LatencyHistogram h;
+    for (int i = 0; i < 990; ++i) h.record(100);
+    for (int i = 0; i < 10; ++i) h.record(5000);
+    EXPECT_EQ(h.count(), 1000u);
+    EXPECT_EQ(h.max(), 5000u);
+    EXPECT_GE(h.percentile(0.5f), 100u);
+    EXPECT_LT(h.percentile(0.5f), 125u);
+    EXPECT_LT(h.percentile(0.99f), 125u);
+    EXPECT_EQ(h.percentile(1.0f), 5000u);
+    h.reset();
+    EXPECT_EQ(h.count(), 0u);
+    EXPECT_EQ(h.percentile(0.5f), 0u);
+}
+
+TEST(LatencyProbeTest, ScopedProbe_RecordsWhenEnabled) {
+    auto& probes = LatencyProbes::instance();
+    probes.reset();
+    {
+        WINDVANE_PROBE(MenuUpdate);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    const ProbeSummary s = probes.summary(Probe::MenuUpdate);
+#if WINDVANE_LATENCY_PROBES
+    EXPECT_EQ(s.count, 1u);
+    EXPECT_GE(s.maxUs, 2000u);
+    EXPECT_GT(probes.loopRateHz(platform::now()), 0.0f);
+#else
+    EXPECT_EQ(s.count, 0u);
+#endif
+    EXPECT_STREQ(s.name, "Menu update");
+}
+
+TEST(LatencyProbeTest, ConcurrentRecords_AreNotLost) {
+    LatencyHistogram h;
+    std::thread a([&] { for (int i = 0; i < 10000; ++i) h.record(static_cast<uint32_t>(i)); });
+    std::thread b([&] { for (int i = 0; i < 10000; ++i) h.record(static_cast<uint32_t>(i)); });
+    a.join();
+    b.join();
+    EXPECT_EQ(h.count(), 20000u);
+    EXPECT_EQ(h.max(), 9999u);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include "WindVane/Acquisition/MeasurementQueue.h"
+
+using namespace testing;
+using namespace WindVane;
+
+namespace {
+
+struct FakeVane {
+    float degrees{0.0f};
+    bool valid{true};
+};
+
+bool readFake(void* context, float& degrees) {
+    auto* vane = static_cast<FakeVane*>(context);
+    degrees = vane->degrees;
+    return vane->valid;
+}
+
+struct ConsumerStats {
+    size_t received{0};
+    bool ordered{true};
+};
+
+// Drains until the producer is done and the queue is empty, checking that
+// timestamps (sequence numbers here) only ever increase.
+ConsumerStats drain(MeasurementQueue& queue, const std::atomic<bool>& done,
+                    std::chrono::microseconds pause) {
+    ConsumerStats stats;
+    DirectionMeasurement block[32];
+    int64_t last = -1;
+    while (!done.load() || queue.available()) {
+        size_t n = queue.readBlock(block, 32);
+        for (size_t i = 0; i < n; ++i) {
+            int64_t t = block[i].timestamp.count();
+            if (t <= last) stats.ordered = false;
+            last = t;
+        }
+        stats.received += n;
+        if (pause.count()) std::this_thread::sleep_for(pause);
+        else if (n == 0) std::this_thread::yield();
+    }
+    return stats;
+}
+
+} // namespace
+
+TEST(MeasurementQueueTest, Sample_WrapsDirectionAndMarksInvalid) {
+    FakeVane vane{-90.25f, true};
+    MeasurementQueue queue;
+    MeasurementPublisher publisher(&readFake, &vane);
+    ASSERT_TRUE(publisher.addConsumer(queue));
+    publisher.sample(TimeMs{5});
+    vane.valid = false;
+    publisher.sample(TimeMs{6});
+
+    DirectionMeasurement out[2];
+    ASSERT_EQ(queue.readBlock(out, 2), 2u);
+    EXPECT_TRUE(out[0].isValid);
+    EXPECT_FLOAT_EQ(out[0].degrees, 269.75f);
+    EXPECT_EQ(out[0].timestamp.count(), 5u);
+    EXPECT_FALSE(out[1].isValid);
+    EXPECT_EQ(out[1].timestamp.count(), 6u);
+}
+
+TEST(MeasurementQueueTest, Stress_SlowConsumerDropsWithoutStallingFastOne) {
+    FakeVane vane{45.0f, true};
+    MeasurementQueue fast, slow;
+    MeasurementPublisher publisher(&readFake, &vane);
+    publisher.addConsumer(fast);
+    publisher.addConsumer(slow);
+
+    constexpr uint32_t kTotal = 200000;
+    std::atomic<bool> done{false};
+    ConsumerStats fastStats, slowStats;
+    std::thread fastThread([&] { fastStats = drain(fast, done, std::chrono::microseconds(0)); });
+    std::thread slowThread([&] { slowStats = drain(slow, done, std::chrono::microseconds(200)); });
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < kTotal; ++i) {
+        publisher.sample(TimeMs{i});
+        // Give the consumers a chance on single-core hosts
+        if ((i & 0xFF) == 0) std::this_thread::yield();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    done.store(true);
+    fastThread.join();
+    slowThread.join();
+
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    RecordProperty("measurements_per_second", static_cast<int>(kTotal / seconds));
+    RecordProperty("fast_dropped", static_cast<int>(fast.dropped()));
+    RecordProperty("slow_dropped", static_cast<int>(slow.dropped()));
+
+    EXPECT_EQ(publisher.published(), kTotal);
+    EXPECT_EQ(fastStats.received + fast.dropped(), kTotal);
+    EXPECT_EQ(slowStats.received + slow.dropped(), kTotal);
+    EXPECT_TRUE(fastStats.ordered);
+    EXPECT_TRUE(slowStats.ordered);
+    EXPECT_GT(slow.dropped(), fast.dropped());
+}
+
+TEST(MeasurementQueueTest, ThreadedSampler_ProducesAtRate) {
+    FakeVane vane{180.0f, true};
+    MeasurementQueue queue;
+    ThreadedMeasurementSampler sampler(&readFake, &vane, 1000);
+    sampler.addConsumer(queue);
+    ASSERT_TRUE(sampler.start());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    sampler.stop();
+    EXPECT_FALSE(sampler.running());
+
+    const uint32_t produced = sampler.published();
+    EXPECT_GT(produced, 20u);
+    EXPECT_LT(produced, 200u);
+    DirectionMeasurement m;
+    ASSERT_EQ(queue.readBlock(&m, 1), 1u);
+    EXPECT_FLOAT_EQ(m.degrees, 180.0f);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <random>
+#include "WindVane/Calibration/NoiseWindow.h"
+
+using namespace testing;
+
+namespace {
+
+// Reference: the linear rescan SpinningMethod used before NoiseWindow. The
+// readings are exact ADC codes, so the float test agrees with the window.
+size_t scanCount(const std::deque<float>& recent, float reading, float threshold) {
+    size_t inRange = 0;
+    for (float r : recent) {
+        if (std::fabs(r - reading) * 4095.0f < threshold * 4095.0f)
+            ++inRange;
+    }
+    return inRange;
+}
+
+} // namespace
+
+TEST(NoiseWindowTest, Reset_ClampsWindowLength) {
+    NoiseWindow window;
+    window.reset(0);
+    EXPECT_EQ(window.window(), 1u);
+    window.reset(1000);
+    EXPECT_EQ(window.window(), NoiseWindow::kCapacity);
+}
+
+TEST(NoiseWindowTest, Push_EvictsOldestOnceFull) {
+    NoiseWindow window;
+    window.reset(3);
+    window.push(0.1f);
+    window.push(0.5f);
+    window.push(0.9f);
+    window.push(0.52f);
+
+    EXPECT_EQ(window.size(), 3u);
+    EXPECT_EQ(window.countWithin(0.1f, 0.05f), 0u);
+    EXPECT_EQ(window.countWithin(0.51f, 0.05f), 2u);
+}
+
+TEST(NoiseWindowTest, CountWithin_ClipsAtScaleEnds) {
+    NoiseWindow window;
+    window.reset(80);
+    for (int i = 0; i < 10; ++i) window.push(0.0f);
+    for (int i = 0; i < 10; ++i) window.push(1.0f);
+
+    EXPECT_EQ(window.countWithin(0.01f, 0.05f), 10u);
+    EXPECT_EQ(window.countWithin(0.99f, 0.05f), 10u);
+    EXPECT_EQ(window.countWithin(0.5f, 0.0f), 0u);
+}
+
+TEST(NoiseWindowTest, CountWithin_MatchesLinearScan) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> detent(0.0f, 1.0f);
+    std::normal_distribution<float> noise(0.0f, 0.02f);
+
+    for (int size : {1, 5, 16, 64, 65, 100}) {
+        NoiseWindow window;
+        window.reset(size);
+        std::deque<float> recent;
+        float centre = detent(rng);
+        for (int i = 0; i < 5000; ++i) {
+            if (i % 40 == 0) centre = detent(rng);
+            // Quantise like the ADC so exact duplicates and ties occur
+            float reading = std::round(std::clamp(centre + noise(rng), 0.0f, 1.0f) * 4095.0f) / 4095.0f;
+
+            window.push(reading);
+            recent.push_back(reading);
+            if (recent.size() > static_cast<size_t>(size)) recent.pop_front();
+
+            ASSERT_EQ(window.countWithin(reading, 0.05f), scanCount(recent, reading, 0.05f))
+                << "size=" << size << " i=" << i;
+        }
+    }
+}
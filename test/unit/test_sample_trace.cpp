@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include "WindVane/IADC.h"
+#include "WindVane/Trace/SampleTrace.h"
+#include "WindVane/Trace/TraceADC.h"
+#include "WindVane/Trace/TraceReplay.h"
+
+using namespace testing;
+
+namespace {
+
+constexpr int kPositions = 16;
+
+uint32_t gClockMs = 0;
+platform::TimeMs fakeClock() { return platform::TimeMs{gClockMs}; }
+
+class RampADC : public IADC {
+public:
+    float read() const override { return readCode() / 4095.0f; }
+    uint16_t readCode() const override { return static_cast<uint16_t>(_next++ % 4096); }
+
+private:
+    mutable uint32_t _next{100};
+};
+
+std::string tracePath(const char* name) { return TempDir() + name; }
+
+// A vane turned steadily through every detent, sampled every 10 ms.
+void writeSpinTrace(const std::string& path, int samplesPerDetent) {
+    TraceWriter writer(path);
+    uint32_t t = 0;
+    for (int d = 0; d < kPositions; ++d) {
+        uint16_t code = static_cast<uint16_t>((0.03f + static_cast<float>(d) / kPositions) * 4095.0f);
+        for (int s = 0; s < samplesPerDetent; ++s, t += 10)
+            writer.append({t, static_cast<uint16_t>(code + (s % 3) - 1)});
+    }
+    ASSERT_TRUE(writer.close().ok());
+}
+
+} // namespace
+
+TEST(SampleTraceTest, RecordingADC_RoundTripsThroughMappedTrace) {
+    const std::string path = tracePath("roundtrip.wvtr");
+    RampADC source;
+    {
+        TraceWriter writer(path);
+        RecordingADC adc(source, writer, &fakeClock);
+        for (gClockMs = 5000; gClockMs < 5100; gClockMs += 10)
+            adc.read();
+        EXPECT_EQ(writer.count(), 10u);
+        ASSERT_TRUE(writer.close().ok());
+    }
+
+    MappedTrace trace;
+    ASSERT_TRUE(trace.open(path).ok());
+    ASSERT_EQ(trace.size(), 10u);
+    for (size_t i = 0; i < trace.size(); ++i) {
+        EXPECT_EQ(trace[i].timestampMs, 5000u + i * 10);
+        EXPECT_EQ(trace[i].code, 100u + i);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(SampleTraceTest, Open_RejectsMissingAndForeignFiles) {
+    MappedTrace trace;
+    EXPECT_EQ(trace.open(tracePath("missing.wvtr")).status, StorageStatus::NotFound);
+
+    const std::string path = tracePath("foreign.wvtr");
+    std::ofstream(path, std::ios::binary) << "not a trace file";
+    EXPECT_EQ(trace.open(path).status, StorageStatus::InvalidFormat);
+    EXPECT_TRUE(trace.empty());
+    std::remove(path.c_str());
+}
+
+TEST(SampleTraceTest, Open_IgnoresTrailingPartialRecord) {
+    const std::string path = tracePath("partial.wvtr");
+    writeSpinTrace(path, 2);
+    std::ofstream(path, std::ios::binary | std::ios::app) << "abc";
+
+    MappedTrace trace;
+    ASSERT_TRUE(trace.open(path).ok());
+    EXPECT_EQ(trace.size(), static_cast<size_t>(kPositions * 2));
+    std::remove(path.c_str());
+}
+
+TEST(TraceReplayTest, Run_FindsRecordedPositions) {
+    const std::string path = tracePath("spin.wvtr");
+    writeSpinTrace(path, 12);
+    MappedTrace trace;
+    ASSERT_TRUE(trace.open(path).ok());
+
+    SpinningConfig cfg;
+    cfg.expectedPositions = kPositions;
+    cfg.threshold = 0.02f;
+    ReplayResult result = TraceReplay(trace).run(cfg);
+
+    EXPECT_EQ(result.progress.status, SessionStatus::Finished);
+    EXPECT_GE(result.clusters.size(), static_cast<size_t>(kPositions - 1));
+    EXPECT_LE(result.samples, trace.size());
+    std::remove(path.c_str());
+}
+
+TEST(TraceReplayTest, Run_StallTimeoutUsesTraceTime) {
+    // Vane parked on one detent for a minute of recorded time
+    const std::string path = tracePath("parked.wvtr");
+    {
+        TraceWriter writer(path);
+        for (uint32_t t = 0; t < 60000; t += 10) writer.append({t, 1000});
+    }
+    MappedTrace trace;
+    ASSERT_TRUE(trace.open(path).ok());
+
+    SpinningConfig cfg;
+    cfg.stallTimeoutSec = 5;
+    auto start = std::chrono::steady_clock::now();
+    ReplayResult result = TraceReplay(trace).run(cfg);
+    auto wall = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(result.progress.status, SessionStatus::Finished);
+    EXPECT_NEAR(static_cast<double>(result.progress.elapsed.count()), 5010.0, 20.0);
+    EXPECT_LT(wall, std::chrono::seconds(1));
+    std::remove(path.c_str());
+}
@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <memory>
+#include "WindVane/Storage/EEPROMSettingsStorage.h"
+#include "WindVane/Storage/EepromIO.h"
+#include "WindVane/Storage/EmulatedEeprom.h"
+#include "WindVane/Storage/JournalSettingsStorage.h"
+
+namespace {
+constexpr size_t kEepromSize = 512;
+
+// Counts how often each byte changes between saves, a stand-in for cell
+// wear on byte-addressed EEPROM.
+class WearTracker {
+public:
+    WearTracker() { snapshot(_last); }
+    void update() {
+        std::array<uint8_t, kEepromSize> now;
+        snapshot(now);
+        for (size_t i = 0; i < kEepromSize; ++i)
+            if (now[i] != _last[i]) ++_writes[i];
+        _last = now;
+    }
+    uint32_t hottest() const { return *std::max_element(_writes.begin(), _writes.end()); }
+
+private:
+    static void snapshot(std::array<uint8_t, kEepromSize>& out) {
+        platform_factory::eeprom_begin(kEepromSize);
+        platform_factory::eeprom_read_bytes(0, out.data(), out.size());
+        platform_factory::eeprom_end();
+    }
+    std::array<uint8_t, kEepromSize> _last{};
+    std::array<uint32_t, kEepromSize> _writes{};
+};
+} // namespace
+
+using namespace testing;
+
+class SettingsJournalTest : public Test {
+protected:
+    void SetUp() override {
+        std::remove(kPath);
+        _eeprom = std::make_unique<EmulatedEeprom>(kPath);
+        platform_factory::use_emulated_eeprom(_eeprom.get());
+        platform_factory::eeprom_reset_stats();
+    }
+    void TearDown() override {
+        platform_factory::use_emulated_eeprom(nullptr);
+        _eeprom.reset();
+        std::remove(kPath);
+    }
+
+    static constexpr const char* kPath = "settings_journal_eeprom.bin";
+    std::unique_ptr<EmulatedEeprom> _eeprom;
+
+    static SettingsData navigate(int i) {
+        SettingsData d{};
+        d.menuState = static_cast<PersistedMenuState>(i % 2 ? 0 : 1 + i % 5);
+        return d;
+    }
+};
+
+TEST_F(SettingsJournalTest, RoundTripsAcrossReboot) {
+    SettingsData data{};
+    data.spin.threshold = 0.125f;
+    data.spin.expectedPositions = 32;
+    data.menuState = PersistedMenuState::Settings;
+    {
+        JournalSettingsStorage journal;
+        ASSERT_TRUE(journal.save(data).ok());
+    }
+    JournalSettingsStorage rebooted;
+    SettingsData loaded{};
+    ASSERT_TRUE(rebooted.load(loaded).ok());
+    EXPECT_FLOAT_EQ(loaded.spin.threshold, 0.125f);
+    EXPECT_EQ(loaded.spin.expectedPositions, 32);
+    EXPECT_EQ(loaded.menuState, PersistedMenuState::Settings);
+}
+
+TEST_F(SettingsJournalTest, NavigationAppendsOneRecordPerChange) {
+    JournalSettingsStorage journal;
+    ASSERT_TRUE(journal.save(navigate(0)).ok());
+    const auto before = platform_factory::eeprom_stats();
+    ASSERT_TRUE(journal.save(navigate(1)).ok());
+    auto after = platform_factory::eeprom_stats();
+    EXPECT_EQ(after.bytesRequested - before.bytesRequested, sizeof(JournalSettingsStorage::Record));
+    EXPECT_EQ(after.commits - before.commits, 1u);
+    // Unchanged data neither writes nor commits
+    ASSERT_TRUE(journal.save(navigate(1)).ok());
+    after = platform_factory::eeprom_stats();
+    EXPECT_EQ(after.bytesRequested - before.bytesRequested, sizeof(JournalSettingsStorage::Record));
+    EXPECT_EQ(after.commits - before.commits, 1u);
+}
+
+TEST_F(SettingsJournalTest, CompactionKeepsLatestState) {
+    constexpr int kNavigations = 1000;
+    JournalSettingsStorage journal;
+    for (int i = 0; i < kNavigations; ++i)
+        ASSERT_TRUE(journal.save(navigate(i)).ok());
+    EXPECT_GT(journal.compactions(), 1u);
+
+    JournalSettingsStorage rebooted;
+    SettingsData loaded{};
+    ASSERT_TRUE(rebooted.load(loaded).ok());
+    EXPECT_EQ(loaded.menuState, navigate(kNavigations - 1).menuState);
+    // The saved head resumes where the previous instance stopped
+    ASSERT_TRUE(rebooted.save(navigate(kNavigations)).ok());
+    JournalSettingsStorage again;
+    ASSERT_TRUE(again.load(loaded).ok());
+    EXPECT_EQ(loaded.menuState, navigate(kNavigations).menuState);
+}
+
+// Journal at 256 and a fixed block at 0 share the emulator without
+// overlapping; each run is measured on its own.
+TEST_F(SettingsJournalTest, WritesLessAndSpreadsWearMoreThanFixedBlock) {
+    constexpr int kNavigations = 1000;
+    JournalSettingsStorage journal(256, kEepromSize);
+    WearTracker journalWear;
+    for (int i = 0; i < kNavigations; ++i) {
+        ASSERT_TRUE(journal.save(navigate(i)).ok());
+        journalWear.update();
+    }
+    const uint32_t journalBytes = platform_factory::eeprom_stats().bytesRequested;
+
+    platform_factory::eeprom_reset_stats();
+    EEPROMSettingsStorage fixed(0, kEepromSize);
+    WearTracker fixedWear;
+    for (int i = 0; i < kNavigations; ++i) {
+        ASSERT_TRUE(fixed.save(navigate(i)).ok());
+        fixedWear.update();
+    }
+    const uint32_t fixedBytes = platform_factory::eeprom_stats().bytesRequested;
+
+    EXPECT_LT(journalBytes, fixedBytes);
+    EXPECT_LT(journalWear.hottest() * 4, fixedWear.hottest());
+}
+
+// The first generations fill each half; later ones end three records short
+// with a multi-field save that does not fit, so the last slots of each
+// half keep their early records. They must not resurface once the 16-bit
+// sequence numbers wrap.
+TEST_F(SettingsJournalTest, SequenceWrapKeepsLatestState) {
+    constexpr size_t kStart = 256;
+    constexpr size_t kRegion = 1024; // 64 records per half
+    JournalSettingsStorage journal(kStart, kStart + kRegion, kRegion);
+    SettingsData data{};
+    ASSERT_TRUE(journal.save(data).ok());
+    int toggle = 0;
+    for (uint32_t gen = 0; gen < 600; ++gen) {
+        const int singles = gen < 2 ? 58 : 55;
+        for (int k = 0; k < singles; ++k) {
+            data.menuState = static_cast<PersistedMenuState>(++toggle % 2);
+            ASSERT_TRUE(journal.save(data).ok());
+        }
+        data.menuState = static_cast<PersistedMenuState>(++toggle % 2);
+        data.spin.bufferSize = 1 + gen % 50;
+        data.spin.sampleDelayMs = 11 + gen % 1000;
+        data.spin.stallTimeoutSec = 1 + gen % 30;
+        ASSERT_TRUE(journal.save(data).ok());
+        ASSERT_EQ(journal.compactions(), gen + 2);
+
+        JournalSettingsStorage rebooted(kStart, kStart + kRegion, kRegion);
+        SettingsData loaded{};
+        ASSERT_TRUE(rebooted.load(loaded).ok());
+        ASSERT_EQ(loaded.menuState, data.menuState) << "generation " << gen;
+        ASSERT_EQ(loaded.spin.bufferSize, data.spin.bufferSize) << "generation " << gen;
+        ASSERT_EQ(loaded.spin.sampleDelayMs, data.spin.sampleDelayMs) << "generation " << gen;
+    }
+}
+
+TEST_F(SettingsJournalTest, TornRecordFallsBackToPreviousValue) {
+    JournalSettingsStorage journal;
+    ASSERT_TRUE(journal.save(navigate(0)).ok());
+    SettingsData next = navigate(0);
+    next.spin.bufferSize = 9;
+    ASSERT_TRUE(journal.save(next).ok());
+    // Corrupt the last record written
+    size_t last = 256 + JournalSettingsStorage::kFieldCount * sizeof(JournalSettingsStorage::Record);
+    platform_factory::eeprom_begin(kEepromSize);
+    uint8_t b = platform_factory::eeprom_read_byte(last + 5);
+    platform_factory::eeprom_write_byte(last + 5, b ^ 0x10);
+    platform_factory::eeprom_commit();
+    platform_factory::eeprom_end();
+
+    JournalSettingsStorage rebooted;
+    SettingsData loaded{};
+    ASSERT_TRUE(rebooted.load(loaded).ok());
+    EXPECT_EQ(loaded.spin.bufferSize, SettingsData{}.spin.bufferSize);
+}
+
+TEST_F(SettingsJournalTest, MigratesFixedBlockSettings) {
+    SettingsData data{};
+    data.spin.sampleDelayMs = 42;
+    EEPROMSettingsStorage fixed;
+    ASSERT_TRUE(fixed.save(data).ok());
+
+    JournalSettingsStorage journal;
+    SettingsData loaded{};
+    ASSERT_TRUE(journal.load(loaded).ok());
+    EXPECT_EQ(loaded.spin.sampleDelayMs, 42);
+    ASSERT_TRUE(journal.save(loaded).ok());
+    JournalSettingsStorage rebooted;
+    ASSERT_TRUE(rebooted.load(loaded).ok());
+    EXPECT_EQ(loaded.spin.sampleDelayMs, 42);
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "WindVane/Storage/SettingsManager.h"
+#include "test_doubles.h"
+
+using namespace testing;
+using platform::TimeMs;
+
+namespace {
+
+using doubles::NullDiagnostics;
+
+class CountingSettingsStorage : public ISettingsStorage {
+public:
+    StorageResult save(const SettingsData& data) override {
+        ++saves;
+        if (fail)
+            return {StorageStatus::IoError, "fail"};
+        stored = data;
+        return {};
+    }
+    StorageResult load(SettingsData& data) override {
+        data = stored;
+        return {};
+    }
+    int getSchemaVersion() const override { return 1; }
+
+    SettingsData stored{};
+    int saves{0};
+    bool fail{false};
+};
+
+} // namespace
+
+class SettingsManagerTest : public Test {
+protected:
+    CountingSettingsStorage storage;
+    NullDiagnostics diag;
+};
+
+TEST_F(SettingsManagerTest, NavigationBurst_CoalescesIntoOneWrite) {
+    SettingsManager mgr(storage, diag);
+    mgr.setFlushDelay(TimeMs{500});
+    for (int i = 0; i < 50; ++i) {
+        mgr.setMenuState(i % 2 ? PersistedMenuState::Main : PersistedMenuState::Settings);
+        EXPECT_TRUE(mgr.poll(TimeMs{static_cast<uint32_t>(i * 10)}).ok());
+    }
+    EXPECT_EQ(storage.saves, 0);
+    EXPECT_TRUE(mgr.dirty());
+
+    mgr.poll(TimeMs{490 + 499});
+    EXPECT_EQ(storage.saves, 0);
+    mgr.poll(TimeMs{490 + 500});
+    EXPECT_EQ(storage.saves, 1);
+    EXPECT_FALSE(mgr.dirty());
+    EXPECT_EQ(storage.stored.menuState, PersistedMenuState::Main);
+
+    mgr.poll(TimeMs{5000});
+    EXPECT_EQ(storage.saves, 1);
+}
+
+TEST_F(SettingsManagerTest, UnchangedState_IsNotDirty) {
+    SettingsManager mgr(storage, diag);
+    mgr.setMenuState(PersistedMenuState::Main);
+    EXPECT_FALSE(mgr.dirty());
+    EXPECT_TRUE(mgr.flush().ok());
+    EXPECT_EQ(storage.saves, 0);
+}
+
+TEST_F(SettingsManagerTest, ExplicitSaveAndShutdown_Flush) {
+    {
+        SettingsManager mgr(storage, diag);
+        mgr.setSpinBufferSize(7);
+        EXPECT_TRUE(mgr.save().ok());
+        EXPECT_EQ(storage.saves, 1);
+        mgr.setSpinExpectedPositions(24);
+    }
+    EXPECT_EQ(storage.saves, 2);
+    EXPECT_EQ(storage.stored.spin.bufferSize, 7);
+    EXPECT_EQ(storage.stored.spin.expectedPositions, 24);
+}
+
+TEST_F(SettingsManagerTest, FailedFlush_IsReportedAndRetried) {
+    SettingsManager mgr(storage, diag);
+    mgr.setFlushDelay(TimeMs{100});
+    storage.fail = true;
+    mgr.setMenuState(PersistedMenuState::Help);
+    mgr.poll(TimeMs{0});
+    EXPECT_FALSE(mgr.poll(TimeMs{100}).ok());
+    EXPECT_FALSE(mgr.lastFlush().ok());
+    EXPECT_TRUE(mgr.dirty());
+
+    storage.fail = false;
+    mgr.poll(TimeMs{150});
+    EXPECT_EQ(storage.saves, 1);
+    EXPECT_TRUE(mgr.poll(TimeMs{200}).ok());
+    EXPECT_EQ(storage.saves, 2);
+    EXPECT_TRUE(mgr.lastFlush().ok());
+    EXPECT_FALSE(mgr.dirty());
+}
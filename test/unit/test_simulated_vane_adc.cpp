@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <vector>
+#include "WindVane/Drivers/SimulatedVaneADC.h"
+#include "WindVane/Calibration/SpinningMethod.h"
+#include "WindVane/Diagnostics/IDiagnostics.h"
+#include "WindVane/Storage/ICalibrationStorage.h"
+#include "test_doubles.h"
+
+using namespace testing;
+
+namespace {
+
+using doubles::MemoryStorage;
+using doubles::NullDiagnostics;
+
+SimulatedVaneConfig quietConfig() {
+    SimulatedVaneConfig cfg;
+    cfg.noiseCodes = 0.0f;
+    cfg.bounceSamples = 0;
+    return cfg;
+}
+
+} // namespace
+
+TEST(SimulatedVaneADCTest, DefaultLadder_HasSixteenDistinctPositions) {
+    SimulatedVaneADC adc(quietConfig());
+    EXPECT_EQ(adc.positions(), 16u);
+
+    std::set<uint16_t> codes;
+    for (int i = 0; i < 16; ++i) codes.insert(adc.idealCode(i * 22.5f));
+    EXPECT_EQ(codes.size(), 16u);
+    EXPECT_EQ(codes.count(4095), 0u);
+}
+
+TEST(SimulatedVaneADCTest, NarrowSwitches_LeaveOpenCircuitGaps) {
+    SimulatedVaneConfig cfg = quietConfig();
+    cfg.closeHalfWidthDeg = 15.0f;
+    SimulatedVaneADC adc(cfg);
+    EXPECT_EQ(adc.positions(), 8u);
+    EXPECT_EQ(adc.idealCode(22.5f), 4095);
+    EXPECT_LT(adc.idealCode(45.0f), 4095);
+}
+
+TEST(SimulatedVaneADCTest, ParkedVane_ReadsIdealCodeWithoutNoise) {
+    SimulatedVaneADC adc(quietConfig());
+    adc.setAngle(90.0f);
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(adc.readCode(), adc.idealCode(90.0f));
+}
+
+TEST(SimulatedVaneADCTest, Noise_HasConfiguredSpread) {
+    SimulatedVaneConfig cfg = quietConfig();
+    cfg.noiseCodes = 4.0f;
+    SimulatedVaneADC adc(cfg);
+    adc.setAngle(180.0f);
+    const double ideal = adc.idealCode(180.0f);
+    double sum = 0.0, sumSq = 0.0;
+    const int n = 20000;
+    for (int i = 0; i < n; ++i) {
+        double d = adc.readCode() - ideal;
+        sum += d;
+        sumSq += d * d;
+    }
+    // idealCode is rounded, so the mean may sit up to half a code away
+    EXPECT_NEAR(sum / n, 0.0, 0.6);
+    EXPECT_NEAR(std::sqrt(sumSq / n), 4.0, 0.4);
+}
+
+TEST(SimulatedVaneADCTest, Bounce_SettlesAfterConfiguredReads) {
+    SimulatedVaneConfig cfg = quietConfig();
+    cfg.bounceSamples = 4;
+    SimulatedVaneADC adc(cfg);
+    adc.setScript(RotationScript{}.hold(0.0f, 10).hold(45.0f, 100));
+
+    for (int i = 0; i < 10; ++i) adc.readCode();
+    std::set<uint16_t> seen;
+    for (int i = 0; i < 4; ++i) seen.insert(adc.readCode());
+    for (uint16_t code : seen)
+        EXPECT_TRUE(code == adc.idealCode(45.0f) || code == 4095);
+    for (int i = 0; i < 50; ++i) EXPECT_EQ(adc.readCode(), adc.idealCode(45.0f));
+}
+
+TEST(SimulatedVaneADCTest, Script_SweepsAndLoops) {
+    SimulatedVaneADC adc(quietConfig());
+    adc.setScript(RotationScript{}.sweep(0.0f, 90.0f, 90).loop());
+    adc.readCode();
+    EXPECT_FLOAT_EQ(adc.angle(), 0.0f);
+    for (int i = 0; i < 45; ++i) adc.readCode();
+    EXPECT_FLOAT_EQ(adc.angle(), 45.0f);
+    for (int i = 0; i < 45; ++i) adc.readCode();
+    EXPECT_FLOAT_EQ(adc.angle(), 0.0f);
+
+    adc.setScript(RotationScript{}.spin(10.0f, -1.0f, 4));
+    for (int i = 0; i < 4; ++i) adc.readCode();
+    EXPECT_FLOAT_EQ(adc.angle(), 100.0f);
+}
+
+TEST(SimulatedVaneADCTest, SpinningCalibration_FindsLadderPositions) {
+    SimulatedVaneADC adc; // default noise and bounce
+    adc.setScript(RotationScript{}.spin(0.0f, 3.0f, 3 * 16 * 40));
+    MemoryStorage storage;
+    NullDiagnostics diag;
+    SpinningConfig cfg;
+    cfg.threshold = 0.01f;
+    cfg.expectedPositions = 16;
+    SpinningMethod method({adc, storage, diag, cfg});
+
+    platform::TimeMs now{0};
+    method.beginSession(now);
+    while (method.step(now)) now += platform::TimeMs{10};
+
+    EXPECT_GE(storage.saved.size(), 15u);
+}
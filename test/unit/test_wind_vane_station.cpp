@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "WindVane/Station/DeadlineScheduler.h"
+#include "WindVane/Station/WindVaneStation.h"
+#include "WindVane/Diagnostics/IDiagnostics.h"
+#include "WindVane/Storage/ICalibrationStorage.h"
+#include "WindVane/UI/IIO.h"
+#include "test_doubles.h"
+
+using namespace testing;
+
+namespace {
+
+using doubles::NullDiagnostics;
+using doubles::NullIO;
+using doubles::NullStorage;
+
+class FixedADC : public IADC {
+public:
+    explicit FixedADC(float value) : _value(value) {}
+    float read() const override { return _value; }
+
+private:
+    float _value;
+};
+
+} // namespace
+
+TEST(DeadlineSchedulerTest, PopDue_EarliestFirstAtEachRate) {
+    DeadlineScheduler sched;
+    sched.add(0, 100000, 0); // 10 Hz
+    sched.add(1, 10000, 0);  // 100 Hz
+    int counts[2] = {0, 0};
+    for (uint32_t now = 0; now < 1000000; now += 1000) {
+        int id;
+        while ((id = sched.popDue(now)) >= 0) ++counts[id];
+    }
+    EXPECT_EQ(counts[0], 10);
+    EXPECT_EQ(counts[1], 100);
+    EXPECT_EQ(sched.overruns(), 0u);
+}
+
+TEST(DeadlineSchedulerTest, PopDue_WrapsAndRestartsAfterOverrun) {
+    DeadlineScheduler sched;
+    const uint32_t nearWrap = 0xFFFFFF00u;
+    sched.add(7, 0x200, nearWrap);
+    EXPECT_EQ(sched.popDue(nearWrap - 1), -1);
+    EXPECT_EQ(sched.popDue(nearWrap), 7);
+    EXPECT_EQ(sched.nextDeadline(), 0x100u);  // wrapped past zero
+    EXPECT_EQ(sched.popDue(0x50), -1);
+
+    // Five periods late: one sample, then the schedule restarts from now
+    EXPECT_EQ(sched.popDue(0xA00), 7);
+    EXPECT_EQ(sched.popDue(0xA00), -1);
+    EXPECT_EQ(sched.overruns(), 1u);
+    EXPECT_EQ(sched.nextDeadline(), 0xC00u);
+}
+
+TEST(WindVaneStationTest, Poll_SamplesEachVaneAtItsOwnRate) {
+    NullIO io;
+    NullDiagnostics diag;
+    FixedADC north(0.0f), east(0.25f);
+    NullStorage storage[2];
+    WindVaneStation station(io, diag);
+    StationVaneConfig slow{north, storage[0]};
+    slow.sampleRateHz = 5;
+    StationVaneConfig fast{east, storage[1]};
+    fast.sampleRateHz = 50;
+    ASSERT_EQ(station.addVane(slow), 0);
+    ASSERT_EQ(station.addVane(fast), 1);
+
+    for (uint32_t now = 0; now < 1000000; now += 500) station.poll(now);
+    EXPECT_EQ(station.reading(0).samples, 5u);
+    EXPECT_EQ(station.reading(1).samples, 50u);
+    EXPECT_NEAR(station.reading(1).degrees, 90.0f, 0.1f);
+    EXPECT_EQ(station.totalSamples(), 55u);
+}
+
+TEST(WindVaneStationTest, Poll_FirstCallAfterLongUptime_SamplesImmediately) {
+    NullIO io;
+    NullDiagnostics diag;
+    FixedADC adc(0.5f);
+    NullStorage storage;
+    WindVaneStation station(io, diag);
+    StationVaneConfig cfg{adc, storage};
+    cfg.sampleRateHz = 10;
+    station.addVane(cfg);
+    EXPECT_FALSE(station.nextDeadlineUs().has_value());
+
+    // Past 2^31 us a deadline of 0 would compare as being in the future
+    const uint32_t uptime = 0x90000000u;
+    EXPECT_EQ(station.poll(uptime), 1u);
+    ASSERT_TRUE(station.nextDeadlineUs().has_value());
+    EXPECT_EQ(*station.nextDeadlineUs(), uptime + 100000u);
+}
+
+TEST(WindVaneStationTest, Averager_FedBySamplesNotByReads) {
+    NullIO io;
+    NullDiagnostics diag;
+    FixedADC adc(0.25f);
+    NullStorage storage;
+    DirectionAverager averager;
+    WindVaneStation station(io, diag);
+    StationVaneConfig cfg{adc, storage};
+    cfg.sampleRateHz = 100;
+    cfg.averager = &averager;
+    station.addVane(cfg);
+
+    for (uint32_t now = 0; now < 100000; now += 1000) station.poll(now);
+    EXPECT_EQ(averager.stats().samples, station.reading(0).samples);
+    EXPECT_NEAR(station.reading(0).degrees, 90.0f, 0.5f);
+}
+
+TEST(WindVaneTest, GetDirection_DoesNotAddToAverager) {
+    NullIO io;
+    NullDiagnostics diag;
+    FixedADC adc(0.5f);
+    NullStorage storage;
+    DirectionAverager averager;
+    WindVaneConfig cfg{adc, WindVaneType::REED_SWITCH, CalibrationMethod::SPINNING, &storage,
+                       io, diag};
+    cfg.averager = &averager;
+    WindVane vane(cfg);
+
+    // Falls back to the instant reading until something is sampled
+    EXPECT_NEAR(vane.getDirection(), 180.0f, 0.5f);
+    for (int i = 0; i < 5; ++i) vane.getDirection();
+    EXPECT_FALSE(averager.stats().valid());
+
+    vane.sample(platform::TimeMs{0});
+    vane.sample(platform::TimeMs{1});
+    EXPECT_EQ(averager.stats().samples, 2u);
+    EXPECT_NEAR(vane.getDirection(), 180.0f, 0.5f);
+    EXPECT_EQ(averager.stats().samples, 2u);
+}
+
+TEST(WindVaneStationTest, Vanes_UseTheirOwnStorageSlots) {
+    NullIO io;
+    NullDiagnostics diag;
+    FixedADC adc(0.5f);
+    NullStorage first, second;
+    WindVaneStation station(io, diag);
+    station.addVane({adc, first});
+    station.addVane({adc, second});
+
+    station.vane(1).clearCalibration();
+    EXPECT_EQ(first.clears, 0);
+    EXPECT_EQ(second.clears, 1);
+    EXPECT_EQ(station.vane(0).getStorage(), &first);
+}
+
+TEST(WindVaneStationTest, Start_SpreadsVanesAcrossWorkers) {
+    NullIO io;
+    NullDiagnostics diag;
+    std::vector<FixedADC> adcs(8, FixedADC(0.5f));
+    std::vector<NullStorage> storage(adcs.size());
+    WindVaneStation station(io, diag);
+    for (size_t i = 0; i < adcs.size(); ++i) {
+        StationVaneConfig cfg{adcs[i], storage[i]};
+        cfg.sampleRateHz = 200;
+        station.addVane(cfg);
+    }
+    ASSERT_TRUE(station.start(3));
+    EXPECT_EQ(station.addVane({adcs[0], storage[0]}), -1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    station.stop();
+    EXPECT_FALSE(station.running());
+
+    for (size_t i = 0; i < adcs.size(); ++i) {
+        EXPECT_GT(station.reading(i).samples, 5u) << "vane " << i;
+        EXPECT_LT(station.reading(i).samples, 40u) << "vane " << i;
+    }
+}